@@ -0,0 +1,186 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/miniconda/lib/cmake/fmt/fmt-config-version.cmake"
+  "/root/miniconda/lib/cmake/fmt/fmt-config.cmake"
+  "/root/miniconda/lib/cmake/fmt/fmt-targets-release.cmake"
+  "/root/miniconda/lib/cmake/fmt/fmt-targets.cmake"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "googletest-src/CMakeLists.txt"
+  "googletest-src/googlemock/CMakeLists.txt"
+  "googletest-src/googlemock/cmake/gmock.pc.in"
+  "googletest-src/googlemock/cmake/gmock_main.pc.in"
+  "googletest-src/googletest/CMakeLists.txt"
+  "googletest-src/googletest/cmake/Config.cmake.in"
+  "googletest-src/googletest/cmake/gtest.pc.in"
+  "googletest-src/googletest/cmake/gtest_main.pc.in"
+  "googletest-src/googletest/cmake/internal_utils.cmake"
+  "/root/repo/benchmarks/CMakeLists.txt"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/gtest.CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets-none.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/benchmark/benchmarkTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-AnyNewerVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeDependentOption.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeFindDependencyMacro.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython/Support.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPython3.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "DartConfiguration.tcl"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "googletest-download/CMakeLists.txt"
+  "strong-types-config-version.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "googletest-build/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "googletest-build/googletest/generated/gmock.pc"
+  "googletest-build/googletest/generated/gmock_main.pc"
+  "googletest-build/googlemock/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "googletest-build/googletest/generated/GTestConfigVersion.cmake"
+  "googletest-build/googletest/generated/GTestConfig.cmake"
+  "googletest-build/googletest/generated/gtest.pc"
+  "googletest-build/googletest/generated/gtest_main.pc"
+  "googletest-build/googletest/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "benchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "CMakeFiles/tests.dir/DependInfo.cmake"
+  "CMakeFiles/tests-cpp20.dir/DependInfo.cmake"
+  "CMakeFiles/tests-optimized.dir/DependInfo.cmake"
+  "CMakeFiles/codegen-kernels.dir/DependInfo.cmake"
+  "googletest-build/googlemock/CMakeFiles/gmock.dir/DependInfo.cmake"
+  "googletest-build/googlemock/CMakeFiles/gmock_main.dir/DependInfo.cmake"
+  "googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  "googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "examples/CMakeFiles/examples.dir/DependInfo.cmake"
+  "examples/CMakeFiles/basic.dir/DependInfo.cmake"
+  "examples/CMakeFiles/definitions.dir/DependInfo.cmake"
+  "examples/CMakeFiles/flags.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-compile-time-benchmark.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/benchmarks.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-benchmarks.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/abstraction_penalty-O0.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-abstraction_penalty-O0.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/abstraction_penalty-Og.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-abstraction_penalty-Og.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/abstraction_penalty-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-abstraction_penalty-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/abstraction_penalty-O3.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-abstraction_penalty-O3.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bulk-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-bulk-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/bulk-O3.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-bulk-O3.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/hash-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-hash-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/wide_flag-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-wide_flag-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/wide_flag-O3.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-wide_flag-O3.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/atomic-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-atomic-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/binary-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-binary-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/binary-O3.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-binary-O3.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/endian-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-endian-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/mapped_array-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-mapped_array-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/csv-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-csv-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/soa_vector-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-soa_vector-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/charconv-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-charconv-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/charconv-O3.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-charconv-O3.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/format-O2.dir/DependInfo.cmake"
+  "benchmarks/CMakeFiles/run-format-O2.dir/DependInfo.cmake"
+  )
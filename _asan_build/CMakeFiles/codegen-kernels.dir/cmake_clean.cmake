@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/codegen-kernels.dir/tests/codegen/kernels.cpp.o"
+  "CMakeFiles/codegen-kernels.dir/tests/codegen/kernels.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/codegen-kernels.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
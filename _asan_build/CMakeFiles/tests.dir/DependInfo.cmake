@@ -0,0 +1,39 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/tests/atomic.cpp" "CMakeFiles/tests.dir/tests/atomic.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/atomic.cpp.o.d"
+  "/root/repo/tests/basic.cpp" "CMakeFiles/tests.dir/tests/basic.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/basic.cpp.o.d"
+  "/root/repo/tests/binary.cpp" "CMakeFiles/tests.dir/tests/binary.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/binary.cpp.o.d"
+  "/root/repo/tests/bulk.cpp" "CMakeFiles/tests.dir/tests/bulk.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/bulk.cpp.o.d"
+  "/root/repo/tests/charconv.cpp" "CMakeFiles/tests.dir/tests/charconv.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/charconv.cpp.o.d"
+  "/root/repo/tests/csv.cpp" "CMakeFiles/tests.dir/tests/csv.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/csv.cpp.o.d"
+  "/root/repo/tests/endian.cpp" "CMakeFiles/tests.dir/tests/endian.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/endian.cpp.o.d"
+  "/root/repo/tests/flags.cpp" "CMakeFiles/tests.dir/tests/flags.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/flags.cpp.o.d"
+  "/root/repo/tests/format.cpp" "CMakeFiles/tests.dir/tests/format.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/format.cpp.o.d"
+  "/root/repo/tests/hash.cpp" "CMakeFiles/tests.dir/tests/hash.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/hash.cpp.o.d"
+  "/root/repo/tests/id_containers.cpp" "CMakeFiles/tests.dir/tests/id_containers.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/id_containers.cpp.o.d"
+  "/root/repo/tests/iostream.cpp" "CMakeFiles/tests.dir/tests/iostream.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/iostream.cpp.o.d"
+  "/root/repo/tests/layout.cpp" "CMakeFiles/tests.dir/tests/layout.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/layout.cpp.o.d"
+  "/root/repo/tests/lazy.cpp" "CMakeFiles/tests.dir/tests/lazy.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/lazy.cpp.o.d"
+  "/root/repo/tests/mapped_array.cpp" "CMakeFiles/tests.dir/tests/mapped_array.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/mapped_array.cpp.o.d"
+  "/root/repo/tests/slot_map.cpp" "CMakeFiles/tests.dir/tests/slot_map.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/slot_map.cpp.o.d"
+  "/root/repo/tests/soa_vector.cpp" "CMakeFiles/tests.dir/tests/soa_vector.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/soa_vector.cpp.o.d"
+  "/root/repo/tests/transparent.cpp" "CMakeFiles/tests.dir/tests/transparent.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/transparent.cpp.o.d"
+  "/root/repo/tests/wide_flag.cpp" "CMakeFiles/tests.dir/tests/wide_flag.cpp.o" "gcc" "CMakeFiles/tests.dir/tests/wide_flag.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_asan_build/googletest-build/googletest/CMakeFiles/gtest_main.dir/DependInfo.cmake"
+  "/root/repo/_asan_build/googletest-build/googletest/CMakeFiles/gtest.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tests.dir/tests/atomic.cpp.o"
+  "CMakeFiles/tests.dir/tests/atomic.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/basic.cpp.o"
+  "CMakeFiles/tests.dir/tests/basic.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/binary.cpp.o"
+  "CMakeFiles/tests.dir/tests/binary.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/bulk.cpp.o"
+  "CMakeFiles/tests.dir/tests/bulk.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/charconv.cpp.o"
+  "CMakeFiles/tests.dir/tests/charconv.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/csv.cpp.o"
+  "CMakeFiles/tests.dir/tests/csv.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/endian.cpp.o"
+  "CMakeFiles/tests.dir/tests/endian.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/flags.cpp.o"
+  "CMakeFiles/tests.dir/tests/flags.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/format.cpp.o"
+  "CMakeFiles/tests.dir/tests/format.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/hash.cpp.o"
+  "CMakeFiles/tests.dir/tests/hash.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/id_containers.cpp.o"
+  "CMakeFiles/tests.dir/tests/id_containers.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/iostream.cpp.o"
+  "CMakeFiles/tests.dir/tests/iostream.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/layout.cpp.o"
+  "CMakeFiles/tests.dir/tests/layout.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/lazy.cpp.o"
+  "CMakeFiles/tests.dir/tests/lazy.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/mapped_array.cpp.o"
+  "CMakeFiles/tests.dir/tests/mapped_array.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/slot_map.cpp.o"
+  "CMakeFiles/tests.dir/tests/slot_map.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/soa_vector.cpp.o"
+  "CMakeFiles/tests.dir/tests/soa_vector.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/transparent.cpp.o"
+  "CMakeFiles/tests.dir/tests/transparent.cpp.o.d"
+  "CMakeFiles/tests.dir/tests/wide_flag.cpp.o"
+  "CMakeFiles/tests.dir/tests/wide_flag.cpp.o.d"
+  "tests"
+  "tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo
+# Build directory: /root/repo/_asan_build
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(gtests "/root/repo/_asan_build/tests")
+set_tests_properties(gtests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;166;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(gtests-cpp20 "/root/repo/_asan_build/tests-cpp20")
+set_tests_properties(gtests-cpp20 PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;172;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(gtests-optimized "/root/repo/_asan_build/tests-optimized")
+set_tests_properties(gtests-optimized PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;184;add_test;/root/repo/CMakeLists.txt;0;")
+add_test(codegen "/usr/bin/cmake" "-DOBJDUMP=/usr/bin/objdump" "-DOBJECTS=/root/repo/_asan_build/CMakeFiles/codegen-kernels.dir/tests/codegen/kernels.cpp.o" "-P" "/root/repo/tests//codegen/compare.cmake")
+set_tests_properties(codegen PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/CMakeLists.txt;218;add_test;/root/repo/CMakeLists.txt;0;")
+subdirs("googletest-build")
+subdirs("examples")
+subdirs("benchmarks")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/atomic-O2.dir/atomic.cpp.o"
+  "CMakeFiles/atomic-O2.dir/atomic.cpp.o.d"
+  "CMakeFiles/atomic-O2.dir/main.cpp.o"
+  "CMakeFiles/atomic-O2.dir/main.cpp.o.d"
+  "atomic-O2"
+  "atomic-O2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/atomic-O2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
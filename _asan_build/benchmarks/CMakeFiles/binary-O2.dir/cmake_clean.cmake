@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/binary-O2.dir/binary.cpp.o"
+  "CMakeFiles/binary-O2.dir/binary.cpp.o.d"
+  "CMakeFiles/binary-O2.dir/main.cpp.o"
+  "CMakeFiles/binary-O2.dir/main.cpp.o.d"
+  "binary-O2"
+  "binary-O2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/binary-O2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bulk-O3.dir/bulk.cpp.o"
+  "CMakeFiles/bulk-O3.dir/bulk.cpp.o.d"
+  "CMakeFiles/bulk-O3.dir/main.cpp.o"
+  "CMakeFiles/bulk-O3.dir/main.cpp.o.d"
+  "bulk-O3"
+  "bulk-O3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bulk-O3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/charconv-O2.dir/charconv.cpp.o"
+  "CMakeFiles/charconv-O2.dir/charconv.cpp.o.d"
+  "CMakeFiles/charconv-O2.dir/main.cpp.o"
+  "CMakeFiles/charconv-O2.dir/main.cpp.o.d"
+  "charconv-O2"
+  "charconv-O2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/charconv-O2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/format-O2.dir/format.cpp.o"
+  "CMakeFiles/format-O2.dir/format.cpp.o.d"
+  "CMakeFiles/format-O2.dir/main.cpp.o"
+  "CMakeFiles/format-O2.dir/main.cpp.o.d"
+  "format-O2"
+  "format-O2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/format-O2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run-abstraction_penalty-O3"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run-abstraction_penalty-O3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run-compile-time-benchmark"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run-compile-time-benchmark.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run-mapped_array-O2"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run-mapped_array-O2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
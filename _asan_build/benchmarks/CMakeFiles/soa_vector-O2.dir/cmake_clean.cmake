@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/soa_vector-O2.dir/main.cpp.o"
+  "CMakeFiles/soa_vector-O2.dir/main.cpp.o.d"
+  "CMakeFiles/soa_vector-O2.dir/soa_vector.cpp.o"
+  "CMakeFiles/soa_vector-O2.dir/soa_vector.cpp.o.d"
+  "soa_vector-O2"
+  "soa_vector-O2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/soa_vector-O2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/benchmarks/main.cpp" "benchmarks/CMakeFiles/wide_flag-O3.dir/main.cpp.o" "gcc" "benchmarks/CMakeFiles/wide_flag-O3.dir/main.cpp.o.d"
+  "/root/repo/benchmarks/wide_flag.cpp" "benchmarks/CMakeFiles/wide_flag-O3.dir/wide_flag.cpp.o" "gcc" "benchmarks/CMakeFiles/wide_flag-O3.dir/wide_flag.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wide_flag-O3.dir/main.cpp.o"
+  "CMakeFiles/wide_flag-O3.dir/main.cpp.o.d"
+  "CMakeFiles/wide_flag-O3.dir/wide_flag.cpp.o"
+  "CMakeFiles/wide_flag-O3.dir/wide_flag.cpp.o.d"
+  "wide_flag-O3"
+  "wide_flag-O3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wide_flag-O3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/flags.dir/flags.cpp.o"
+  "CMakeFiles/flags.dir/flags.cpp.o.d"
+  "flags"
+  "flags.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/flags.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/abstraction_penalty-Og.dir/abstraction_penalty.cpp.o"
+  "CMakeFiles/abstraction_penalty-Og.dir/abstraction_penalty.cpp.o.d"
+  "CMakeFiles/abstraction_penalty-Og.dir/main.cpp.o"
+  "CMakeFiles/abstraction_penalty-Og.dir/main.cpp.o.d"
+  "abstraction_penalty-Og"
+  "abstraction_penalty-Og.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/abstraction_penalty-Og.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/binary-O3.dir/binary.cpp.o"
+  "CMakeFiles/binary-O3.dir/binary.cpp.o.d"
+  "CMakeFiles/binary-O3.dir/main.cpp.o"
+  "CMakeFiles/binary-O3.dir/main.cpp.o.d"
+  "binary-O3"
+  "binary-O3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/binary-O3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
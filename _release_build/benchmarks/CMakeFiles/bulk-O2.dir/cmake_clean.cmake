@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/bulk-O2.dir/bulk.cpp.o"
+  "CMakeFiles/bulk-O2.dir/bulk.cpp.o.d"
+  "CMakeFiles/bulk-O2.dir/main.cpp.o"
+  "CMakeFiles/bulk-O2.dir/main.cpp.o.d"
+  "bulk-O2"
+  "bulk-O2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bulk-O2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/charconv-O3.dir/charconv.cpp.o"
+  "CMakeFiles/charconv-O3.dir/charconv.cpp.o.d"
+  "CMakeFiles/charconv-O3.dir/main.cpp.o"
+  "CMakeFiles/charconv-O3.dir/main.cpp.o.d"
+  "charconv-O3"
+  "charconv-O3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/charconv-O3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
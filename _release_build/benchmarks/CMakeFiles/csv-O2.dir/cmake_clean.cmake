@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/csv-O2.dir/csv.cpp.o"
+  "CMakeFiles/csv-O2.dir/csv.cpp.o.d"
+  "CMakeFiles/csv-O2.dir/main.cpp.o"
+  "CMakeFiles/csv-O2.dir/main.cpp.o.d"
+  "csv-O2"
+  "csv-O2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/csv-O2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/endian-O2.dir/endian.cpp.o"
+  "CMakeFiles/endian-O2.dir/endian.cpp.o.d"
+  "CMakeFiles/endian-O2.dir/main.cpp.o"
+  "CMakeFiles/endian-O2.dir/main.cpp.o.d"
+  "endian-O2"
+  "endian-O2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/endian-O2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/hash-O2.dir/hash.cpp.o"
+  "CMakeFiles/hash-O2.dir/hash.cpp.o.d"
+  "CMakeFiles/hash-O2.dir/main.cpp.o"
+  "CMakeFiles/hash-O2.dir/main.cpp.o.d"
+  "hash-O2"
+  "hash-O2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hash-O2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
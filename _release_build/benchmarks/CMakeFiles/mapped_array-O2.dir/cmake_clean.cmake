@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/mapped_array-O2.dir/main.cpp.o"
+  "CMakeFiles/mapped_array-O2.dir/main.cpp.o.d"
+  "CMakeFiles/mapped_array-O2.dir/mapped_array.cpp.o"
+  "CMakeFiles/mapped_array-O2.dir/mapped_array.cpp.o.d"
+  "mapped_array-O2"
+  "mapped_array-O2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mapped_array-O2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
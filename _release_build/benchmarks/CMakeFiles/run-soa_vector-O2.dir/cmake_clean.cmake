@@ -0,0 +1,8 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/run-soa_vector-O2"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/run-soa_vector-O2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/definitions.dir/definitions.cpp.o"
+  "CMakeFiles/definitions.dir/definitions.cpp.o.d"
+  "definitions"
+  "definitions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/definitions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
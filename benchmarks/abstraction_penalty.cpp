@@ -0,0 +1,199 @@
+#include <benchmark/benchmark.h>
+
+#include <strong_types.hpp>
+#include <strong_types/flags.hpp>
+
+#include <cstdint>
+#include <vector>
+
+// Every kernel below is instantiated once with a raw type and once with its
+// strong counterpart. Both instances are registered as "<kernel>/raw" and
+// "<kernel>/strong" so that main.cpp can report their ratio.
+
+namespace st = dpsg::strong_types;
+
+namespace {
+
+using strong_int = st::number<int, struct strong_int_tag>;
+using strong_double = st::number<double, struct strong_double_tag>;
+using strong_id = st::strong_value<std::int64_t,
+                                   struct strong_id_tag,
+                                   st::arithmetic,
+                                   st::comparable>;
+
+enum class permission : std::uint32_t {
+  none = 0,
+  read = 1,
+  write = 2,
+  execute = 4,
+  admin = 8
+};
+using permissions = st::flag<permission, struct permissions_tag>;
+
+constexpr std::int64_t sizes[] = {1 << 10, 1 << 16};
+
+template <class T, class = void>
+struct value_type_of {
+  using type = T;
+};
+template <class T>
+struct value_type_of<T, st::detail::void_t<typename T::value_type>> {
+  using type = typename T::value_type;
+};
+
+template <class T, class V>
+T make(V v) {
+  return T(static_cast<typename value_type_of<T>::type>(v));
+}
+
+template <class T>
+std::vector<T> make_sequence(std::size_t size) {
+  std::vector<T> result;
+  result.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    result.push_back(make<T>(static_cast<int>(i % 1021) + 1));
+  }
+  return result;
+}
+
+// total += v[i]
+template <class T>
+void accumulate(benchmark::State& state) {
+  const auto values = make_sequence<T>(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    T total{};
+    for (const T& v : values) {
+      total += v;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// out[i] = a[i] * k + b[i], mixing strong/strong and strong/raw operators
+template <class T, class Raw>
+void multiply_add(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto a = make_sequence<T>(size);
+  const auto b = make_sequence<T>(size);
+  std::vector<T> out(size);
+  const Raw k = 3;
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < size; ++i) {
+      out[i] = a[i] * k + b[i];
+    }
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// count of v[i] such that lower < v[i] <= upper, and the running maximum
+template <class T>
+void compare(benchmark::State& state) {
+  const auto values = make_sequence<T>(static_cast<std::size_t>(state.range(0)));
+  const T lower = make<T>(100);
+  const T upper = make<T>(900);
+  for (auto _ : state) {
+    std::int64_t count = 0;
+    T maximum = values.front();
+    for (const T& v : values) {
+      if (lower < v && v <= upper) {
+        ++count;
+      }
+      if (maximum < v) {
+        maximum = v;
+      }
+    }
+    benchmark::DoNotOptimize(count);
+    benchmark::DoNotOptimize(maximum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class T>
+std::vector<T> make_permissions(std::size_t size) {
+  std::vector<T> result;
+  result.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    result.push_back(static_cast<T>(i % 16));
+  }
+  return result;
+}
+
+// Union of every flag, and number of sets granting both read and write
+void flags_raw(benchmark::State& state) {
+  using underlying = std::underlying_type_t<permission>;
+  const auto values =
+      make_permissions<permission>(static_cast<std::size_t>(state.range(0)));
+  const auto mask = static_cast<permission>(
+      static_cast<underlying>(permission::read) |
+      static_cast<underlying>(permission::write));
+  for (auto _ : state) {
+    permission all = permission::none;
+    std::int64_t count = 0;
+    for (permission p : values) {
+      all = static_cast<permission>(static_cast<underlying>(all) |
+                                    static_cast<underlying>(p));
+      if (static_cast<permission>(static_cast<underlying>(p) &
+                                  static_cast<underlying>(mask)) == mask) {
+        ++count;
+      }
+    }
+    benchmark::DoNotOptimize(all);
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void flags_strong(benchmark::State& state) {
+  std::vector<permissions> values;
+  for (permission p :
+       make_permissions<permission>(static_cast<std::size_t>(state.range(0)))) {
+    values.emplace_back(p);
+  }
+  const permissions mask = permissions{permission::read} | permission::write;
+  for (auto _ : state) {
+    permissions all{};
+    std::int64_t count = 0;
+    for (const permissions& p : values) {
+      all |= p;
+      if ((p & mask) == mask) {
+        ++count;
+      }
+    }
+    benchmark::DoNotOptimize(all);
+    benchmark::DoNotOptimize(count);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define DPSG_REGISTER(name, ...) \
+  BENCHMARK(__VA_ARGS__)->Name(name)->Arg(sizes[0])->Arg(sizes[1])
+
+DPSG_REGISTER("accumulate/int/raw", accumulate<int>);
+DPSG_REGISTER("accumulate/int/strong", accumulate<strong_int>);
+DPSG_REGISTER("accumulate/double/raw", accumulate<double>);
+DPSG_REGISTER("accumulate/double/strong", accumulate<strong_double>);
+DPSG_REGISTER("accumulate/strong_value/raw", accumulate<std::int64_t>);
+DPSG_REGISTER("accumulate/strong_value/strong", accumulate<strong_id>);
+
+DPSG_REGISTER("multiply_add/int/raw", multiply_add<int, int>);
+DPSG_REGISTER("multiply_add/int/strong", multiply_add<strong_int, int>);
+DPSG_REGISTER("multiply_add/double/raw", multiply_add<double, double>);
+DPSG_REGISTER("multiply_add/double/strong",
+              multiply_add<strong_double, double>);
+
+DPSG_REGISTER("compare/int/raw", compare<int>);
+DPSG_REGISTER("compare/int/strong", compare<strong_int>);
+DPSG_REGISTER("compare/double/raw", compare<double>);
+DPSG_REGISTER("compare/double/strong", compare<strong_double>);
+DPSG_REGISTER("compare/strong_value/raw", compare<std::int64_t>);
+DPSG_REGISTER("compare/strong_value/strong", compare<strong_id>);
+
+DPSG_REGISTER("flags/raw", flags_raw);
+DPSG_REGISTER("flags/strong", flags_strong);
+
+#undef DPSG_REGISTER
+
+}  // namespace
@@ -0,0 +1,136 @@
+#include <benchmark/benchmark.h>
+
+#include <strong_types/atomic.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+// Counters shared by 1 to 8 threads, incremented with std::atomic
+// ("<kernel>/raw") and with atomic_number ("<kernel>/strong"). Every thread
+// increments the same counter, so the time per increment grows with the
+// number of threads as the cache line holding the counter moves between the
+// cores.
+//
+// The "sharded" and "per_thread" kernels measure how much of that cost is
+// avoided by keeping the counters of different threads on different cache
+// lines: a single std::atomic against a sharded_counter, and adjacent
+// per-thread numbers against cacheline_aligned ones. A ratio below 1 is the
+// gain of the strong version.
+
+namespace st = dpsg::strong_types;
+
+namespace {
+
+using bytes = st::number<std::uint64_t, struct bytes_tag>;
+using ratio = st::number<double, struct ratio_tag>;
+
+std::atomic<std::uint64_t> raw_counter{0};
+st::atomic_number<std::uint64_t, struct bytes_tag> strong_counter;
+std::atomic<double> raw_total{0};
+st::atomic_number<double, struct ratio_tag> strong_total;
+
+constexpr int increments = 1 << 10;
+
+void fetch_add_raw(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int i = 0; i < increments; ++i) {
+      raw_counter.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * increments);
+}
+
+void fetch_add_strong(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int i = 0; i < increments; ++i) {
+      strong_counter.fetch_add(bytes{std::uint64_t{1}},
+                               std::memory_order_relaxed);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * increments);
+}
+
+// Floating point additions are compare-exchange loops in both cases
+void fetch_add_double_raw(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int i = 0; i < increments; ++i) {
+      double current = raw_total.load(std::memory_order_relaxed);
+      while (!raw_total.compare_exchange_weak(current, current + 1.,
+                                              std::memory_order_relaxed)) {
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * increments);
+}
+
+void fetch_add_double_strong(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int i = 0; i < increments; ++i) {
+      strong_total.fetch_add(ratio{1.}, std::memory_order_relaxed);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * increments);
+}
+
+st::sharded_counter<bytes> sharded_counter;
+
+void sharded_raw(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int i = 0; i < increments; ++i) {
+      raw_counter.fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * increments);
+}
+
+void sharded_strong(benchmark::State& state) {
+  for (auto _ : state) {
+    for (int i = 0; i < increments; ++i) {
+      sharded_counter.add(bytes{std::uint64_t{1}});
+    }
+  }
+  benchmark::DoNotOptimize(sharded_counter.load());
+  state.SetItemsProcessed(state.iterations() * increments);
+}
+
+using padded_bytes =
+    st::number<std::uint64_t, struct padded_bytes_tag, st::cacheline_aligned>;
+
+bytes adjacent_counters[8];
+padded_bytes padded_counters[8];
+
+template <class T>
+void per_thread(benchmark::State& state, T* counters) {
+  T& counter = counters[state.thread_index()];
+  for (auto _ : state) {
+    for (int i = 0; i < increments; ++i) {
+      counter += T{std::uint64_t{1}};
+      benchmark::ClobberMemory();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * increments);
+}
+
+void per_thread_raw(benchmark::State& state) {
+  per_thread(state, adjacent_counters);
+}
+
+void per_thread_strong(benchmark::State& state) {
+  per_thread(state, padded_counters);
+}
+
+#define DPSG_REGISTER(name, fn) \
+  BENCHMARK(fn)->Name(name)->ThreadRange(1, 8)->UseRealTime()
+
+DPSG_REGISTER("fetch_add/raw", fetch_add_raw);
+DPSG_REGISTER("fetch_add/strong", fetch_add_strong);
+DPSG_REGISTER("fetch_add_double/raw", fetch_add_double_raw);
+DPSG_REGISTER("fetch_add_double/strong", fetch_add_double_strong);
+DPSG_REGISTER("sharded/raw", sharded_raw);
+DPSG_REGISTER("sharded/strong", sharded_strong);
+DPSG_REGISTER("per_thread/raw", per_thread_raw);
+DPSG_REGISTER("per_thread/strong", per_thread_strong);
+
+#undef DPSG_REGISTER
+
+}  // namespace
@@ -0,0 +1,146 @@
+#include <benchmark/benchmark.h>
+
+#include <strong_types.hpp>
+#include <strong_types/binary.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Encodes and decodes arrays of quantities in network byte order, with a loop
+// swapping the bytes of each value by hand ("<kernel>/raw"), and with encode
+// and decode on serializable strong numbers ("<kernel>/strong"). The "native"
+// kernels use the byte order of the host, for which encode is a memcpy.
+
+namespace st = dpsg::strong_types;
+
+namespace {
+
+using quantity = st::number<std::uint32_t,
+                            struct quantity_tag,
+                            st::serializable<st::endianness::big>>;
+using native_quantity = st::number<std::uint32_t,
+                                   struct native_quantity_tag,
+                                   st::serializable<st::endianness::native>>;
+
+constexpr std::int64_t sizes[] = {1 << 10, 1 << 16};
+
+std::uint32_t swap(std::uint32_t value) noexcept {
+  return ((value & 0x000000FFu) << 24) | ((value & 0x0000FF00u) << 8) |
+         ((value & 0x00FF0000u) >> 8) | ((value & 0xFF000000u) >> 24);
+}
+
+template <class T>
+std::vector<T> make_quantities(std::size_t size) {
+  std::vector<T> result;
+  result.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    result.emplace_back(static_cast<std::uint32_t>(i * 2654435761u));
+  }
+  return result;
+}
+
+void encode_raw(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto quantities = make_quantities<std::uint32_t>(size);
+  std::vector<std::byte> buffer(size * sizeof(std::uint32_t));
+  for (auto _ : state) {
+    std::byte* out = buffer.data();
+    for (std::uint32_t q : quantities) {
+      const std::uint32_t swapped = swap(q);
+      std::memcpy(out, &swapped, sizeof swapped);
+      out += sizeof swapped;
+    }
+    benchmark::DoNotOptimize(buffer.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * 4);
+}
+
+void encode_strong(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto quantities = make_quantities<quantity>(size);
+  std::vector<std::byte> buffer(size * sizeof(std::uint32_t));
+  for (auto _ : state) {
+    st::encode(quantities.data(), size, buffer.data());
+    benchmark::DoNotOptimize(buffer.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * 4);
+}
+
+void decode_raw(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  std::vector<std::byte> buffer(size * sizeof(std::uint32_t));
+  const auto values = make_quantities<quantity>(size);
+  st::encode(values.data(), size, buffer.data());
+  std::vector<std::uint32_t> quantities(size);
+  for (auto _ : state) {
+    const std::byte* in = buffer.data();
+    for (std::uint32_t& q : quantities) {
+      std::uint32_t swapped;
+      std::memcpy(&swapped, in, sizeof swapped);
+      q = swap(swapped);
+      in += sizeof swapped;
+    }
+    benchmark::DoNotOptimize(quantities.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * 4);
+}
+
+void decode_strong(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  std::vector<std::byte> buffer(size * sizeof(std::uint32_t));
+  const auto values = make_quantities<quantity>(size);
+  st::encode(values.data(), size, buffer.data());
+  std::vector<quantity> quantities(size);
+  for (auto _ : state) {
+    st::decode(buffer.data(), quantities.data(), size);
+    benchmark::DoNotOptimize(quantities.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * 4);
+}
+
+void encode_native_raw(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto quantities = make_quantities<std::uint32_t>(size);
+  std::vector<std::byte> buffer(size * sizeof(std::uint32_t));
+  for (auto _ : state) {
+    std::byte* out = buffer.data();
+    for (std::uint32_t q : quantities) {
+      std::memcpy(out, &q, sizeof q);
+      out += sizeof q;
+    }
+    benchmark::DoNotOptimize(buffer.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * 4);
+}
+
+void encode_native_strong(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto quantities = make_quantities<native_quantity>(size);
+  std::vector<std::byte> buffer(size * sizeof(std::uint32_t));
+  for (auto _ : state) {
+    st::encode(quantities.data(), size, buffer.data());
+    benchmark::DoNotOptimize(buffer.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0) * 4);
+}
+
+#define DPSG_REGISTER(name, ...) \
+  BENCHMARK(__VA_ARGS__)->Name(name)->Arg(sizes[0])->Arg(sizes[1])
+
+DPSG_REGISTER("binary/encode/raw", encode_raw);
+DPSG_REGISTER("binary/encode/strong", encode_strong);
+DPSG_REGISTER("binary/decode/raw", decode_raw);
+DPSG_REGISTER("binary/decode/strong", decode_strong);
+DPSG_REGISTER("binary/encode_native/raw", encode_native_raw);
+DPSG_REGISTER("binary/encode_native/strong", encode_native_strong);
+
+#undef DPSG_REGISTER
+
+}  // namespace
@@ -0,0 +1,128 @@
+#include <benchmark/benchmark.h>
+
+#include <strong_types.hpp>
+#include <strong_types/bulk.hpp>
+
+#include <cstdint>
+#include <vector>
+
+// Each kernel is written once as a plain loop over doubles ("<kernel>/raw"),
+// and once with the bulk functions over strong numbers ("<kernel>/strong").
+// A ratio below 1 means the bulk function beats the auto-vectorizer.
+
+namespace st = dpsg::strong_types;
+
+namespace {
+
+using price = st::number<double, struct price_tag>;
+
+constexpr std::int64_t sizes[] = {1 << 10, 1 << 16};
+
+template <class T>
+std::vector<T> make_sequence(std::size_t size) {
+  std::vector<T> result;
+  result.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    result.emplace_back(static_cast<double>(i % 1021) + 1);
+  }
+  return result;
+}
+
+void add_raw(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto a = make_sequence<double>(size);
+  const auto b = make_sequence<double>(size);
+  std::vector<double> out(size);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < size; ++i) {
+      out[i] = a[i] + b[i];
+    }
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void add_strong(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto a = make_sequence<price>(size);
+  const auto b = make_sequence<price>(size);
+  std::vector<price> out(size);
+  for (auto _ : state) {
+    st::add(a.data(), b.data(), out.data(), size);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void fma_raw(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto a = make_sequence<double>(size);
+  const auto b = make_sequence<double>(size);
+  const auto c = make_sequence<double>(size);
+  std::vector<double> out(size);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < size; ++i) {
+      out[i] = a[i] * b[i] + c[i];
+    }
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void fma_strong(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto a = make_sequence<price>(size);
+  const auto b = make_sequence<price>(size);
+  const auto c = make_sequence<price>(size);
+  std::vector<price> out(size);
+  for (auto _ : state) {
+    st::fma(a.data(), b.data(), c.data(), out.data(), size);
+    benchmark::DoNotOptimize(out.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Without -ffast-math, the compiler cannot reorder the additions of a plain
+// loop, so the raw reduction is not vectorized.
+void dot_raw(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto a = make_sequence<double>(size);
+  const auto b = make_sequence<double>(size);
+  for (auto _ : state) {
+    double total = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+      total += a[i] * b[i];
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void dot_strong(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto a = make_sequence<price>(size);
+  const auto b = make_sequence<price>(size);
+  for (auto _ : state) {
+    price total = st::dot(a.data(), b.data(), size);
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define DPSG_REGISTER(name, ...) \
+  BENCHMARK(__VA_ARGS__)->Name(name)->Arg(sizes[0])->Arg(sizes[1])
+
+DPSG_REGISTER("bulk/add/raw", add_raw);
+DPSG_REGISTER("bulk/add/strong", add_strong);
+DPSG_REGISTER("bulk/fma/raw", fma_raw);
+DPSG_REGISTER("bulk/fma/strong", fma_strong);
+DPSG_REGISTER("bulk/dot/raw", dot_raw);
+DPSG_REGISTER("bulk/dot/strong", dot_strong);
+
+#undef DPSG_REGISTER
+
+}  // namespace
@@ -0,0 +1,160 @@
+#include <benchmark/benchmark.h>
+
+#include <strong_types.hpp>
+#include <strong_types/charconv.hpp>
+#include <strong_types/iostream.hpp>
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Writing and parsing comma separated prices with std::to_chars and
+// std::from_chars on doubles ("<kernel>/raw"), and with to_chars_n and
+// from_chars_n on strong numbers ("<kernel>/strong"). The "ostream" kernels
+// give the cost of the streaming operators for reference.
+
+namespace st = dpsg::strong_types;
+
+namespace {
+
+using price = st::number<double,
+                         struct price_tag,
+                         st::charconv_formattable,
+                         st::streamable>;
+
+constexpr std::int64_t sizes[] = {1 << 10, 1 << 14};
+constexpr std::size_t max_length = 32;
+
+template <class T>
+std::vector<T> make_prices(std::size_t size) {
+  std::vector<T> result;
+  result.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    result.emplace_back(static_cast<double>(i % 10007) / 100);
+  }
+  return result;
+}
+
+void write_raw(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto prices = make_prices<double>(size);
+  std::vector<char> buffer(size * max_length);
+  for (auto _ : state) {
+    char* first = buffer.data();
+    char* const last = first + buffer.size();
+    for (std::size_t i = 0; i < size; ++i) {
+      if (i != 0) {
+        *first++ = ',';
+      }
+      first = std::to_chars(first, last, prices[i]).ptr;
+    }
+    benchmark::DoNotOptimize(first);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void write_strong(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto prices = make_prices<price>(size);
+  std::vector<char> buffer(size * max_length);
+  for (auto _ : state) {
+    auto result = st::to_chars_n(buffer.data(), buffer.data() + buffer.size(),
+                                 prices.data(), size, ',');
+    benchmark::DoNotOptimize(result.ptr);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void write_ostream(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto prices = make_prices<price>(size);
+  for (auto _ : state) {
+    std::ostringstream stream;
+    for (std::size_t i = 0; i < size; ++i) {
+      if (i != 0) {
+        stream << ',';
+      }
+      stream << prices[i];
+    }
+    benchmark::DoNotOptimize(stream.str().data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+std::vector<char> make_input(std::size_t size) {
+  const auto prices = make_prices<double>(size);
+  std::vector<char> buffer(size * max_length);
+  auto result = st::to_chars_n(buffer.data(), buffer.data() + buffer.size(),
+                               prices.data(), size, ',');
+  buffer.resize(static_cast<std::size_t>(result.ptr - buffer.data()));
+  return buffer;
+}
+
+void read_raw(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto input = make_input(size);
+  std::vector<double> prices(size);
+  for (auto _ : state) {
+    const char* first = input.data();
+    const char* const last = first + input.size();
+    for (std::size_t i = 0; i < size; ++i) {
+      if (i != 0) {
+        ++first;
+      }
+      first = std::from_chars(first, last, prices[i]).ptr;
+    }
+    benchmark::DoNotOptimize(prices.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void read_strong(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto input = make_input(size);
+  std::vector<price> prices(size);
+  for (auto _ : state) {
+    auto result = st::from_chars_n(input.data(), input.data() + input.size(),
+                                   prices.data(), size, ',');
+    benchmark::DoNotOptimize(result.count);
+    benchmark::DoNotOptimize(prices.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void read_istream(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto input = make_input(size);
+  std::vector<double> prices(size);
+  for (auto _ : state) {
+    std::istringstream stream{std::string{input.begin(), input.end()}};
+    char separator;
+    for (std::size_t i = 0; i < size; ++i) {
+      if (i != 0) {
+        stream >> separator;
+      }
+      stream >> prices[i];
+    }
+    benchmark::DoNotOptimize(prices.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define DPSG_REGISTER(name, ...) \
+  BENCHMARK(__VA_ARGS__)->Name(name)->Arg(sizes[0])->Arg(sizes[1])
+
+DPSG_REGISTER("charconv/write/raw", write_raw);
+DPSG_REGISTER("charconv/write/strong", write_strong);
+DPSG_REGISTER("charconv/write/ostream", write_ostream);
+DPSG_REGISTER("charconv/read/raw", read_raw);
+DPSG_REGISTER("charconv/read/strong", read_strong);
+DPSG_REGISTER("charconv/read/istream", read_istream);
+
+#undef DPSG_REGISTER
+
+}  // namespace
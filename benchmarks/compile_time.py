@@ -0,0 +1,233 @@
+#!/usr/bin/env python3
+"""Compile-time cost of strong type declarations.
+
+Generates translation units declaring N strong types with M additional
+modifiers each, using a few operators of every type, and compiles them with
+debug information. For every (kind, N, M) configuration it records:
+
+- the compilation wall time,
+- the peak memory of the compiler,
+- the size of the object file and of its debug information,
+- with Clang, the number and duration of template instantiations, taken from
+  the -ftime-trace output.
+
+Results are printed as a table and can be written with --output in the JSON
+format of Google Benchmark, so that they can be tracked and compared with the
+same tools as the runtime benchmarks.
+"""
+
+import argparse
+import json
+import os
+import platform
+import shlex
+import struct
+import subprocess
+import sys
+import tempfile
+import time
+
+# Modifiers added on top of the ones built into each kind. They are picked in
+# this order, M at a time.
+MODIFIERS = [
+    "st::comparable_with<long>",
+    "st::arithmetically_compatible_with<long long>",
+    "st::commutative_under<st::multiplies, short>",
+    "st::compatible_under<st::divides, unsigned char>",
+    "st::comparable_with<short>",
+    "st::commutative_under<st::plus, signed char>",
+    "st::compatible_under<st::minus, unsigned short>",
+    "st::comparable_with<signed char>",
+]
+
+KINDS = {
+    "number": (
+        "using type_{i} = st::number<int, struct tag_{i}{modifiers}>;",
+        "int use_{i}(type_{i} a, type_{i} b) {{\n"
+        "  a += b;\n"
+        "  return (a * b - b / a == b) ? (a < b) : (a >= b);\n"
+        "}}",
+    ),
+    "strong_value": (
+        "using type_{i} = st::strong_value<int, struct tag_{i}, st::arithmetic,"
+        " st::comparable{modifiers}>;",
+        "int use_{i}(type_{i} a, type_{i} b) {{\n"
+        "  a += b;\n"
+        "  return (a * b - b / a == b) ? (a < b) : (a >= b);\n"
+        "}}",
+    ),
+}
+
+
+def generate(kind, types, modifiers):
+    declaration, use = KINDS[kind]
+    extra = "".join(", " + m for m in MODIFIERS[:modifiers])
+    lines = ["#include <strong_types.hpp>", "", "namespace st = dpsg::strong_types;", ""]
+    for i in range(types):
+        lines.append(declaration.format(i=i, modifiers=extra))
+        lines.append(use.format(i=i))
+    return "\n".join(lines) + "\n"
+
+
+def debug_info_size(path):
+    """Size of the .debug_* sections of an ELF object, None for other formats."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"\x7fELF" or data[4] != 2:
+        return None
+    endian = "<" if data[5] == 1 else ">"
+    shoff = struct.unpack_from(endian + "Q", data, 0x28)[0]
+    shentsize, shnum, shstrndx = struct.unpack_from(endian + "HHH", data, 0x3A)
+
+    def section(index):
+        name, _, _, _, offset, size = struct.unpack_from(
+            endian + "IIQQQQ", data, shoff + index * shentsize)
+        return name, offset, size
+
+    _, strtab, _ = section(shstrndx)
+    total = 0
+    for index in range(shnum):
+        name, _, size = section(index)
+        end = data.index(b"\0", strtab + name)
+        if data[strtab + name:end].startswith((b".debug_", b".zdebug_")):
+            total += size
+    return total
+
+
+def time_trace_summary(path):
+    """Number and total duration (ms) of template instantiations."""
+    with open(path) as f:
+        trace = json.load(f)
+    count, duration = 0, 0.0
+    for event in trace.get("traceEvents", []):
+        if event.get("name") in ("InstantiateClass", "InstantiateFunction"):
+            count += 1
+            duration += event.get("dur", 0) / 1000.0
+    return count, duration
+
+
+def compile_once(args, source, directory):
+    source_path = os.path.join(directory, "generated.cpp")
+    object_path = os.path.join(directory, "generated.o")
+    with open(source_path, "w") as f:
+        f.write(source)
+
+    command = [args.compiler, "-std=" + args.std, "-I", args.include, "-g", "-c",
+               source_path, "-o", object_path] + shlex.split(args.flags)
+    if args.clang:
+        command.append("-ftime-trace")
+
+    start = time.perf_counter()
+    process = subprocess.Popen(command, stderr=subprocess.PIPE)
+    _, status, usage = os.wait4(process.pid, 0)
+    elapsed = time.perf_counter() - start
+    errors = process.stderr.read().decode(errors="replace")
+    process.stderr.close()
+    if status != 0:
+        sys.exit("compilation failed: {}\n{}".format(" ".join(command), errors))
+
+    # ru_maxrss is in kilobytes on Linux and in bytes on macOS
+    peak = usage.ru_maxrss // 1024 if sys.platform == "darwin" else usage.ru_maxrss
+    result = {
+        "real_time": elapsed * 1000.0,
+        "peak_memory_kb": peak,
+        "object_bytes": os.path.getsize(object_path),
+    }
+    debug = debug_info_size(object_path)
+    if debug is not None:
+        result["debug_info_bytes"] = debug
+    trace = os.path.join(directory, "generated.json")
+    if args.clang and os.path.exists(trace):
+        count, duration = time_trace_summary(trace)
+        result["instantiations"] = count
+        result["instantiation_time_ms"] = duration
+    return result
+
+
+def is_clang(compiler):
+    try:
+        version = subprocess.run([compiler, "--version"],
+                                 stdout=subprocess.PIPE,
+                                 stderr=subprocess.DEVNULL).stdout
+    except OSError:
+        return False
+    return b"clang" in version
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--compiler", default=os.environ.get("CXX", "c++"))
+    parser.add_argument("--include", required=True,
+                        help="strong_types include directory")
+    parser.add_argument("--std", default="c++14")
+    parser.add_argument("--flags", default="-O0", help="additional compiler flags")
+    parser.add_argument("--kinds", nargs="+", default=list(KINDS), choices=list(KINDS))
+    parser.add_argument("--types", nargs="+", type=int, default=[10, 100, 300])
+    parser.add_argument("--modifiers", nargs="+", type=int, default=[0, 4, 8])
+    parser.add_argument("--repetitions", type=int, default=3,
+                        help="the fastest compilation of each configuration is kept")
+    parser.add_argument("--output", help="write the results as Google Benchmark JSON")
+    args = parser.parse_args()
+    args.clang = is_clang(args.compiler)
+
+    if max(args.modifiers) > len(MODIFIERS):
+        parser.error("at most {} modifiers are supported".format(len(MODIFIERS)))
+
+    results = []
+    header = "{:<48} {:>10} {:>12} {:>12} {:>12}".format(
+        "Configuration", "time (ms)", "memory (kB)", "object (B)", "debug (B)")
+    if args.clang:
+        header += " {:>14} {:>16}".format("instantiations", "inst. time (ms)")
+    print(header)
+    for kind in args.kinds:
+        for types in args.types:
+            for modifiers in args.modifiers:
+                source = generate(kind, types, modifiers)
+                runs = []
+                for _ in range(args.repetitions):
+                    with tempfile.TemporaryDirectory() as directory:
+                        runs.append(compile_once(args, source, directory))
+                best = min(runs, key=lambda run: run["real_time"])
+                best["peak_memory_kb"] = max(run["peak_memory_kb"] for run in runs)
+                name = "compile_time/{}/types:{}/modifiers:{}".format(kind, types, modifiers)
+                line = "{:<48} {:>10.1f} {:>12} {:>12} {:>12}".format(
+                    name, best["real_time"], best["peak_memory_kb"],
+                    best["object_bytes"], best.get("debug_info_bytes", "-"))
+                if args.clang:
+                    line += " {:>14} {:>16.1f}".format(best["instantiations"],
+                                                      best["instantiation_time_ms"])
+                print(line, flush=True)
+                results.append(dict(best, name=name))
+
+    if args.output:
+        benchmarks = []
+        for index, result in enumerate(results):
+            entry = {
+                "name": result["name"],
+                "run_name": result["name"],
+                "run_type": "iteration",
+                "family_index": index,
+                "per_family_instance_index": 0,
+                "repetitions": args.repetitions,
+                "iterations": 1,
+                "real_time": result["real_time"],
+                "cpu_time": result["real_time"],
+                "time_unit": "ms",
+            }
+            entry.update({k: v for k, v in result.items()
+                          if k not in ("name", "real_time")})
+            benchmarks.append(entry)
+        context = {
+            "date": time.strftime("%Y-%m-%dT%H:%M:%S%z"),
+            "host_name": platform.node(),
+            "executable": " ".join([args.compiler, "-std=" + args.std, args.flags]),
+            "num_cpus": os.cpu_count(),
+            "library_build_type": "release",
+        }
+        with open(args.output, "w") as f:
+            json.dump({"context": context, "benchmarks": benchmarks}, f, indent=2)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include <strong_types.hpp>
+#include <strong_types/csv.hpp>
+#include <strong_types/iostream.hpp>
+
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Parses trades (id, price, quantity) from comma separated text into one
+// vector per column, with a loop calling memchr and std::from_chars on the
+// raw values ("<kernel>/raw"), with csv_reader on strong types
+// ("<kernel>/strong"), and with the streaming operators of streamable strong
+// types ("<kernel>/istream").
+
+namespace st = dpsg::strong_types;
+
+namespace {
+
+using order_id =
+    st::strong_value<std::uint64_t, struct order_id_tag, st::streamable>;
+using price = st::number<double, struct price_tag, st::streamable>;
+using quantity = st::number<std::int32_t, struct quantity_tag, st::streamable>;
+
+constexpr std::int64_t sizes[] = {1 << 10, 1 << 16};
+
+std::string make_trades(std::size_t size) {
+  std::string text;
+  for (std::size_t i = 0; i < size; ++i) {
+    text += std::to_string(1000000 + i * 7919) + ',' +
+            std::to_string(i % 10007) + '.' + std::to_string(i % 100) + ',' +
+            std::to_string(i % 500) + '\n';
+  }
+  return text;
+}
+
+template <class T>
+const char* parse_until(const char* first,
+                        const char* last,
+                        char end,
+                        T& value) {
+  const char* separator = static_cast<const char*>(
+      std::memchr(first, end, static_cast<std::size_t>(last - first)));
+  std::from_chars(first, separator, value);
+  return separator + 1;
+}
+
+void parse_raw(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const std::string text = make_trades(size);
+  for (auto _ : state) {
+    std::vector<std::uint64_t> ids;
+    std::vector<double> prices;
+    std::vector<std::int32_t> quantities;
+    const char* first = text.data();
+    const char* const last = first + text.size();
+    while (first != last) {
+      std::uint64_t id;
+      double p;
+      std::int32_t q;
+      first = parse_until(first, last, ',', id);
+      first = parse_until(first, last, ',', p);
+      first = parse_until(first, last, '\n', q);
+      ids.push_back(id);
+      prices.push_back(p);
+      quantities.push_back(q);
+    }
+    benchmark::DoNotOptimize(ids.data());
+    benchmark::DoNotOptimize(prices.data());
+    benchmark::DoNotOptimize(quantities.data());
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(text.size()));
+}
+
+void parse_strong(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const std::string text = make_trades(size);
+  for (auto _ : state) {
+    st::csv_reader<order_id, price, quantity> reader;
+    reader.feed(text);
+    reader.finish();
+    benchmark::DoNotOptimize(reader.column<price>().data());
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(text.size()));
+}
+
+void parse_istream(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const std::string text = make_trades(size);
+  for (auto _ : state) {
+    std::istringstream stream{text};
+    std::vector<order_id> ids;
+    std::vector<price> prices;
+    std::vector<quantity> quantities;
+    order_id id;
+    price p;
+    quantity q;
+    char comma;
+    while (stream >> id >> comma >> p >> comma >> q) {
+      ids.push_back(id);
+      prices.push_back(p);
+      quantities.push_back(q);
+    }
+    benchmark::DoNotOptimize(prices.data());
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          static_cast<std::int64_t>(text.size()));
+}
+
+#define DPSG_REGISTER(name, ...) \
+  BENCHMARK(__VA_ARGS__)->Name(name)->Arg(sizes[0])->Arg(sizes[1])
+
+DPSG_REGISTER("csv/parse/raw", parse_raw);
+DPSG_REGISTER("csv/parse/strong", parse_strong);
+DPSG_REGISTER("csv/parse/istream", parse_istream);
+
+#undef DPSG_REGISTER
+
+}  // namespace
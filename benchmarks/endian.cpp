@@ -0,0 +1,108 @@
+#include <benchmark/benchmark.h>
+
+#include <strong_types.hpp>
+#include <strong_types/endian.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+// Counts the messages of a symbol in a buffer of big endian packet headers,
+// by decoding each header to the byte order of the host before filtering it
+// ("<kernel>/raw"), and by comparing the fields of headers of endian
+// storages placed over the buffer ("<kernel>/strong").
+
+namespace st = dpsg::strong_types;
+
+namespace {
+
+using sequence = st::number<std::uint32_t, struct sequence_tag>;
+using symbol_id = st::number<std::uint16_t, struct symbol_id_tag>;
+using quantity = st::number<std::uint32_t, struct quantity_tag>;
+
+struct wire_header {
+  st::big_endian<sequence> sequence_number;
+  st::big_endian<symbol_id> symbol;
+  st::big_endian<quantity> size;
+};
+
+struct header {
+  std::uint32_t sequence_number;
+  std::uint16_t symbol;
+  std::uint32_t size;
+};
+
+constexpr std::int64_t sizes[] = {1 << 10, 1 << 16};
+constexpr std::uint16_t wanted = 7;
+
+std::vector<std::byte> make_packets(std::size_t count) {
+  std::vector<std::byte> buffer(count * sizeof(wire_header));
+  auto* headers = reinterpret_cast<wire_header*>(buffer.data());
+  for (std::size_t i = 0; i < count; ++i) {
+    headers[i].sequence_number = sequence{static_cast<std::uint32_t>(i)};
+    headers[i].symbol = symbol_id{static_cast<std::uint16_t>(i % 13)};
+    headers[i].size = quantity{static_cast<std::uint32_t>(i % 100)};
+  }
+  return buffer;
+}
+
+std::uint32_t load32(const std::byte* in) noexcept {
+  std::uint32_t value;
+  std::memcpy(&value, in, sizeof value);
+  return __builtin_bswap32(value);
+}
+
+std::uint16_t load16(const std::byte* in) noexcept {
+  std::uint16_t value;
+  std::memcpy(&value, in, sizeof value);
+  return __builtin_bswap16(value);
+}
+
+void filter_raw(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto buffer = make_packets(count);
+  std::vector<header> headers(count);
+  for (auto _ : state) {
+    const std::byte* in = buffer.data();
+    for (header& h : headers) {
+      h.sequence_number = load32(in);
+      h.symbol = load16(in + 4);
+      h.size = load32(in + 6);
+      in += sizeof(wire_header);
+    }
+    std::uint64_t total = 0;
+    for (const header& h : headers) {
+      if (h.symbol == wanted) {
+        total += h.size;
+      }
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void filter_strong(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto buffer = make_packets(count);
+  for (auto _ : state) {
+    const auto* headers = reinterpret_cast<const wire_header*>(buffer.data());
+    quantity total{0u};
+    for (std::size_t i = 0; i < count; ++i) {
+      if (headers[i].symbol == symbol_id{wanted}) {
+        total += headers[i].size;
+      }
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define DPSG_REGISTER(name, ...) \
+  BENCHMARK(__VA_ARGS__)->Name(name)->Arg(sizes[0])->Arg(sizes[1])
+
+DPSG_REGISTER("endian/filter/raw", filter_raw);
+DPSG_REGISTER("endian/filter/strong", filter_strong);
+
+#undef DPSG_REGISTER
+
+}  // namespace
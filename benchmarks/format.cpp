@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include <strong_types.hpp>
+#include <strong_types/format.hpp>
+
+#include <cstdint>
+#include <vector>
+
+// Formats log lines into a preallocated buffer with {fmt}, passing the values
+// of the strong types ("<kernel>/raw") or the strong types themselves
+// ("<kernel>/strong").
+
+namespace st = dpsg::strong_types;
+
+namespace {
+
+using price = st::number<double, struct price_tag>;
+using quantity = st::number<std::int32_t, struct quantity_tag>;
+using order_id = st::strong_value<std::uint64_t, struct order_id_tag>;
+
+constexpr std::int64_t sizes[] = {1 << 8, 1 << 12};
+
+struct order {
+  order_id id;
+  price unit_price;
+  quantity count;
+};
+
+std::vector<order> make_orders(std::size_t size) {
+  std::vector<order> result;
+  result.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    result.push_back(order{order_id{i * 7919},
+                           price{static_cast<double>(i % 10007) / 100},
+                           quantity{static_cast<std::int32_t>(i % 100)}});
+  }
+  return result;
+}
+
+void log_raw(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto orders = make_orders(size);
+  std::vector<char> buffer(size * 64);
+  for (auto _ : state) {
+    char* out = buffer.data();
+    for (const order& o : orders) {
+      out = fmt::format_to(out, "order {:016x}: {} x {:.2f}\n", o.id.value,
+                           o.count.value, o.unit_price.value);
+    }
+    benchmark::DoNotOptimize(out);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void log_strong(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto orders = make_orders(size);
+  std::vector<char> buffer(size * 64);
+  for (auto _ : state) {
+    char* out = buffer.data();
+    for (const order& o : orders) {
+      out = fmt::format_to(out, "order {:016x}: {} x {:.2f}\n", o.id, o.count,
+                           o.unit_price);
+    }
+    benchmark::DoNotOptimize(out);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define DPSG_REGISTER(name, ...) \
+  BENCHMARK(__VA_ARGS__)->Name(name)->Arg(sizes[0])->Arg(sizes[1])
+
+DPSG_REGISTER("format/log/raw", log_raw);
+DPSG_REGISTER("format/log/strong", log_strong);
+
+#undef DPSG_REGISTER
+
+}  // namespace
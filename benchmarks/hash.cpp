@@ -0,0 +1,164 @@
+#include <benchmark/benchmark.h>
+
+#include <strong_types.hpp>
+#include <strong_types/hash.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+// Compares the hashers available to hashable_with on sets of sequential and
+// random ids. Open addressing tables with a power of two capacity index their
+// slots with the low bits of the hash, where the identity hash of libstdc++
+// clusters sequential ids. The average number of slots visited per lookup is
+// reported as the "probes" counter. Note that clustered sequential ids are
+// also adjacent in memory, which makes the identity fast on small tables
+// despite the longer probes.
+
+namespace st = dpsg::strong_types;
+
+namespace {
+
+template <class Hasher>
+using id = st::strong_value<std::uint64_t,
+                            struct id_tag,
+                            st::hashable_with<Hasher>,
+                            st::comparable>;
+using std_id = id<std::hash<std::uint64_t>>;
+using fibonacci_id = id<st::fibonacci_hash>;
+using mix_id = id<st::mix_hash>;
+using wy_id = id<st::wy_hash>;
+
+constexpr std::int64_t sizes[] = {1 << 12, 1 << 18};
+
+// Linear probing, with a load factor of 1/2 and the id 0 as empty marker
+template <class T, class Hasher>
+class flat_set {
+ public:
+  explicit flat_set(std::size_t size)
+      : mask_{capacity(size) - 1}, slots_(mask_ + 1) {}
+
+  void insert(const T& value) {
+    std::size_t i = index(value);
+    while (slots_[i] != T{} && slots_[i] != value) {
+      i = (i + 1) & mask_;
+    }
+    slots_[i] = value;
+  }
+
+  // Number of slots visited to find the value (0 if absent)
+  std::size_t probes(const T& value) const {
+    std::size_t i = index(value);
+    for (std::size_t count = 1;; ++count) {
+      if (slots_[i] == value) {
+        return count;
+      }
+      if (slots_[i] == T{}) {
+        return 0;
+      }
+      i = (i + 1) & mask_;
+    }
+  }
+
+ private:
+  static std::size_t capacity(std::size_t size) {
+    std::size_t result = 1;
+    while (result < size * 2) {
+      result *= 2;
+    }
+    return result;
+  }
+
+  std::size_t index(const T& value) const {
+    return Hasher{}(value.value) & mask_;
+  }
+
+  std::size_t mask_;
+  std::vector<T> slots_;
+};
+
+// Sequential ids with a stride of 8, or ids spread over the whole range
+template <class T>
+std::vector<T> make_ids(std::size_t size, bool sequential) {
+  std::vector<T> result;
+  result.reserve(size);
+  std::mt19937_64 random{42};
+  for (std::size_t i = 0; i < size; ++i) {
+    result.emplace_back(sequential ? i * 8 + 8 : random() | 1);
+  }
+  return result;
+}
+
+template <class T, class Hasher, bool Sequential>
+void flat_lookup(benchmark::State& state) {
+  const auto ids =
+      make_ids<T>(static_cast<std::size_t>(state.range(0)), Sequential);
+  flat_set<T, Hasher> set{ids.size()};
+  for (const T& i : ids) {
+    set.insert(i);
+  }
+  std::size_t probes = 0;
+  for (auto _ : state) {
+    probes = 0;
+    for (const T& i : ids) {
+      probes += set.probes(i);
+    }
+    benchmark::DoNotOptimize(probes);
+  }
+  state.counters["probes"] =
+      static_cast<double>(probes) / static_cast<double>(ids.size());
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <class T, bool Sequential>
+void unordered_lookup(benchmark::State& state) {
+  const auto ids =
+      make_ids<T>(static_cast<std::size_t>(state.range(0)), Sequential);
+  const std::unordered_set<T> set(ids.begin(), ids.end());
+  for (auto _ : state) {
+    std::size_t found = 0;
+    for (const T& i : ids) {
+      found += set.count(i);
+    }
+    benchmark::DoNotOptimize(found);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define DPSG_REGISTER(name, ...) \
+  BENCHMARK(__VA_ARGS__)->Name(name)->Arg(sizes[0])->Arg(sizes[1])
+
+DPSG_REGISTER("flat/sequential/std_hash",
+              flat_lookup<std_id, std::hash<std::uint64_t>, true>);
+DPSG_REGISTER("flat/sequential/fibonacci_hash",
+              flat_lookup<fibonacci_id, st::fibonacci_hash, true>);
+DPSG_REGISTER("flat/sequential/mix_hash",
+              flat_lookup<mix_id, st::mix_hash, true>);
+DPSG_REGISTER("flat/sequential/wy_hash", flat_lookup<wy_id, st::wy_hash, true>);
+DPSG_REGISTER("flat/random/std_hash",
+              flat_lookup<std_id, std::hash<std::uint64_t>, false>);
+DPSG_REGISTER("flat/random/fibonacci_hash",
+              flat_lookup<fibonacci_id, st::fibonacci_hash, false>);
+DPSG_REGISTER("flat/random/mix_hash",
+              flat_lookup<mix_id, st::mix_hash, false>);
+DPSG_REGISTER("flat/random/wy_hash", flat_lookup<wy_id, st::wy_hash, false>);
+
+DPSG_REGISTER("unordered_set/sequential/std_hash",
+              unordered_lookup<std_id, true>);
+DPSG_REGISTER("unordered_set/sequential/fibonacci_hash",
+              unordered_lookup<fibonacci_id, true>);
+DPSG_REGISTER("unordered_set/sequential/mix_hash",
+              unordered_lookup<mix_id, true>);
+DPSG_REGISTER("unordered_set/sequential/wy_hash",
+              unordered_lookup<wy_id, true>);
+DPSG_REGISTER("unordered_set/random/std_hash", unordered_lookup<std_id, false>);
+DPSG_REGISTER("unordered_set/random/fibonacci_hash",
+              unordered_lookup<fibonacci_id, false>);
+DPSG_REGISTER("unordered_set/random/mix_hash", unordered_lookup<mix_id, false>);
+DPSG_REGISTER("unordered_set/random/wy_hash", unordered_lookup<wy_id, false>);
+
+#undef DPSG_REGISTER
+
+}  // namespace
@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdio>
+#include <map>
+#include <string>
+
+// Benchmarks registered as "<name>/raw" and "<name>/strong" are paired by
+// name (and arguments) and their ratio is printed once every benchmark ran. A
+// ratio close to 1 means the strong type is as cheap as the type it wraps.
+class ratio_reporter : public benchmark::ConsoleReporter {
+ public:
+  void ReportRuns(const std::vector<Run>& reports) override {
+    benchmark::ConsoleReporter::ReportRuns(reports);
+    for (const Run& run : reports) {
+      if (run.run_type != Run::RT_Iteration || run.error_occurred) {
+        continue;
+      }
+      record(run);
+    }
+  }
+
+  void Finalize() override {
+    benchmark::ConsoleReporter::Finalize();
+    if (pairs_.empty()) {
+      return;
+    }
+    std::printf("\n%-48s %14s %14s %8s\n", "Benchmark", "raw", "strong", "ratio");
+    for (const auto& p : pairs_) {
+      const timings& t = p.second;
+      if (t.raw <= 0 || t.strong <= 0) {
+        continue;
+      }
+      std::printf("%-48s %11.2f ns %11.2f ns %8.3f\n",
+                  p.first.c_str(),
+                  t.raw,
+                  t.strong,
+                  t.strong / t.raw);
+    }
+  }
+
+ private:
+  struct timings {
+    double raw = 0;
+    double strong = 0;
+  };
+
+  void record(const Run& run) {
+    static const std::string raw_suffix = "/raw";
+    static const std::string strong_suffix = "/strong";
+
+    const std::string& name = run.run_name.function_name;
+    const auto ends_with = [&name](const std::string& suffix) {
+      return name.size() > suffix.size() &&
+             name.compare(name.size() - suffix.size(), suffix.size(), suffix) ==
+                 0;
+    };
+
+    double timings::*slot = nullptr;
+    std::size_t suffix_size = 0;
+    if (ends_with(raw_suffix)) {
+      slot = &timings::raw;
+      suffix_size = raw_suffix.size();
+    }
+    else if (ends_with(strong_suffix)) {
+      slot = &timings::strong;
+      suffix_size = strong_suffix.size();
+    }
+    else {
+      return;
+    }
+
+    std::string key = name.substr(0, name.size() - suffix_size);
+    if (!run.run_name.args.empty()) {
+      key += '/' + run.run_name.args;
+    }
+    if (!run.run_name.threads.empty()) {
+      key += '/' + run.run_name.threads;
+    }
+    const double ns = run.GetAdjustedRealTime() *
+                      benchmark::GetTimeUnitMultiplier(benchmark::kNanosecond) /
+                      benchmark::GetTimeUnitMultiplier(run.time_unit);
+    pairs_[key].*slot = ns;
+  }
+
+  std::map<std::string, timings> pairs_;
+};
+
+int main(int argc, char** argv) {
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  ratio_reporter reporter;
+  benchmark::RunSpecifiedBenchmarks(&reporter);
+  benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,103 @@
+#include <benchmark/benchmark.h>
+
+#include <strong_types.hpp>
+#include <strong_types/mapped_array.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Loads a snapshot of prices from a file and reads a single value ("first")
+// or all of them ("sum"), by reading the file into a vector of doubles
+// ("<kernel>/raw"), and by mapping it with mapped_array ("<kernel>/strong").
+// The file stays in the page cache, so the time measured is the time spent
+// copying or mapping it.
+
+namespace st = dpsg::strong_types;
+
+namespace {
+
+using price = st::number<double, struct price_tag>;
+
+constexpr std::int64_t sizes[] = {1 << 16, 1 << 22};
+
+std::string snapshot(std::size_t size) {
+  const std::string path = "strong_types_snapshot_" + std::to_string(size);
+  auto prices = st::mapped_array<price>::create(path, size);
+  for (std::size_t i = 0; i < size; ++i) {
+    prices[i] = price{static_cast<double>(i % 1021)};
+  }
+  return path;
+}
+
+std::vector<double> read_file(const std::string& path) {
+  std::FILE* file = std::fopen(path.c_str(), "rb");
+  std::fseek(file, 0, SEEK_END);
+  const auto file_size = static_cast<std::size_t>(std::ftell(file));
+  std::fseek(file, 64, SEEK_SET);
+  std::vector<double> values((file_size - 64) / sizeof(double));
+  const std::size_t read =
+      std::fread(values.data(), sizeof(double), values.size(), file);
+  std::fclose(file);
+  values.resize(read);
+  return values;
+}
+
+void first_raw(benchmark::State& state) {
+  const std::string path = snapshot(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    const std::vector<double> values = read_file(path);
+    benchmark::DoNotOptimize(values[values.size() / 2]);
+  }
+  std::remove(path.c_str());
+}
+
+void first_strong(benchmark::State& state) {
+  const std::string path = snapshot(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    const st::mapped_array<const price> values{path};
+    benchmark::DoNotOptimize(values[values.size() / 2]);
+  }
+  std::remove(path.c_str());
+}
+
+void sum_raw(benchmark::State& state) {
+  const std::string path = snapshot(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    const std::vector<double> values = read_file(path);
+    double total = 0;
+    for (double v : values) {
+      total += v;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  std::remove(path.c_str());
+}
+
+void sum_strong(benchmark::State& state) {
+  const std::string path = snapshot(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    const st::mapped_array<const price> values{path};
+    price total{0.};
+    for (const price& v : values) {
+      total += v;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  std::remove(path.c_str());
+}
+
+#define DPSG_REGISTER(name, ...) \
+  BENCHMARK(__VA_ARGS__)->Name(name)->Arg(sizes[0])->Arg(sizes[1])
+
+DPSG_REGISTER("mapped_array/first/raw", first_raw);
+DPSG_REGISTER("mapped_array/first/strong", first_strong);
+DPSG_REGISTER("mapped_array/sum/raw", sum_raw);
+DPSG_REGISTER("mapped_array/sum/strong", sum_strong);
+
+#undef DPSG_REGISTER
+
+}  // namespace
@@ -0,0 +1,111 @@
+#include <benchmark/benchmark.h>
+
+#include <strong_types.hpp>
+#include <strong_types/bulk.hpp>
+#include <strong_types/soa_vector.hpp>
+
+#include <cstdint>
+#include <vector>
+
+// An order book snapshot stored as a vector of structures of strong types
+// ("<kernel>/raw") and as a soa_vector of the same strong types
+// ("<kernel>/strong"). "sum" adds the prices of every order, reading a single
+// field, and "fill" builds the snapshot row by row.
+
+namespace st = dpsg::strong_types;
+
+namespace {
+
+using order_id = st::strong_value<std::uint64_t, struct order_id_tag>;
+using timestamp = st::strong_value<std::uint64_t, struct timestamp_tag>;
+using price = st::number<double, struct price_tag>;
+using quantity = st::number<std::int64_t, struct quantity_tag>;
+
+struct order {
+  order_id id;
+  timestamp time;
+  price limit;
+  quantity size;
+};
+
+using orders = st::soa_vector<order_id, timestamp, price, quantity>;
+
+constexpr std::int64_t sizes[] = {1 << 12, 1 << 20};
+
+order make_order(std::size_t i) {
+  return order{order_id{i}, timestamp{i * 1000},
+               price{static_cast<double>(i % 1021) + 0.5},
+               quantity{static_cast<std::int64_t>(i % 100)}};
+}
+
+std::vector<order> make_structures(std::size_t size) {
+  std::vector<order> result;
+  result.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    result.push_back(make_order(i));
+  }
+  return result;
+}
+
+orders make_columns(std::size_t size) {
+  orders result;
+  result.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    const order o = make_order(i);
+    result.push_back(o.id, o.time, o.limit, o.size);
+  }
+  return result;
+}
+
+void sum_raw(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const std::vector<order> book = make_structures(size);
+  for (auto _ : state) {
+    price total{0.};
+    for (const order& o : book) {
+      total += o.limit;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void sum_strong(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const orders book = make_columns(size);
+  for (auto _ : state) {
+    const price total = st::sum(book.data<price>(), book.size());
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void fill_raw(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    std::vector<order> book = make_structures(size);
+    benchmark::DoNotOptimize(book.data());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void fill_strong(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    orders book = make_columns(size);
+    benchmark::DoNotOptimize(book.data<price>());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define DPSG_REGISTER(name, ...) \
+  BENCHMARK(__VA_ARGS__)->Name(name)->Arg(sizes[0])->Arg(sizes[1])
+
+DPSG_REGISTER("soa_vector/sum/raw", sum_raw);
+DPSG_REGISTER("soa_vector/sum/strong", sum_strong);
+DPSG_REGISTER("soa_vector/fill/raw", fill_raw);
+DPSG_REGISTER("soa_vector/fill/strong", fill_strong);
+
+#undef DPSG_REGISTER
+
+}  // namespace
@@ -0,0 +1,137 @@
+#include <benchmark/benchmark.h>
+
+#include <strong_types/wide_flag.hpp>
+
+#include <bitset>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// Entitlement checks over sets of 512 flags, written with std::bitset
+// ("<kernel>/raw") and with wide_flag ("<kernel>/strong"). A ratio below 1
+// means wide_flag is faster.
+
+namespace st = dpsg::strong_types;
+
+namespace {
+
+constexpr std::size_t flag_count = 512;
+enum class feature : std::uint16_t {};
+using features = st::wide_flag<feature, flag_count>;
+using bitset = std::bitset<flag_count>;
+
+constexpr std::int64_t sizes[] = {1 << 8, 1 << 14};
+
+// Sets with one flag in 4 set, and the flags required by the checks
+template <class T, class Set>
+std::vector<T> make_sets(std::size_t size, Set&& set) {
+  std::vector<T> result(size);
+  std::mt19937 random{42};
+  for (T& flags : result) {
+    for (std::size_t i = 0; i < flag_count; ++i) {
+      if (random() % 4 == 0) {
+        set(flags, i);
+      }
+    }
+  }
+  return result;
+}
+
+std::vector<bitset> make_bitsets(std::size_t size) {
+  return make_sets<bitset>(size, [](bitset& b, std::size_t i) { b.set(i); });
+}
+std::vector<features> make_features(std::size_t size) {
+  return make_sets<features>(size, [](features& f, std::size_t i) {
+    f.set(static_cast<feature>(i));
+  });
+}
+
+void includes_raw(benchmark::State& state) {
+  const auto sets = make_bitsets(static_cast<std::size_t>(state.range(0)));
+  const bitset required = sets[0] & sets[1];
+  for (auto _ : state) {
+    std::size_t allowed = 0;
+    for (const bitset& s : sets) {
+      allowed += (s & required) == required;
+    }
+    benchmark::DoNotOptimize(allowed);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void includes_strong(benchmark::State& state) {
+  const auto sets = make_features(static_cast<std::size_t>(state.range(0)));
+  const features required = sets[0] & sets[1];
+  for (auto _ : state) {
+    std::size_t allowed = 0;
+    for (const features& s : sets) {
+      allowed += st::all_of(s, required);
+    }
+    benchmark::DoNotOptimize(allowed);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void merge_raw(benchmark::State& state) {
+  const auto sets = make_bitsets(static_cast<std::size_t>(state.range(0)));
+  const bitset revoked = sets[0];
+  for (auto _ : state) {
+    bitset result;
+    for (const bitset& s : sets) {
+      result |= s & ~revoked;
+    }
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void merge_strong(benchmark::State& state) {
+  const auto sets = make_features(static_cast<std::size_t>(state.range(0)));
+  const features revoked = sets[0];
+  for (auto _ : state) {
+    features result;
+    for (const features& s : sets) {
+      result |= st::and_not(s, revoked);
+    }
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void count_raw(benchmark::State& state) {
+  const auto sets = make_bitsets(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::size_t total = 0;
+    for (const bitset& s : sets) {
+      total += s.count();
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void count_strong(benchmark::State& state) {
+  const auto sets = make_features(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state) {
+    std::size_t total = 0;
+    for (const features& s : sets) {
+      total += st::count(s);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+#define DPSG_REGISTER(name, fn) \
+  BENCHMARK(fn)->Name(name)->Arg(sizes[0])->Arg(sizes[1])
+
+DPSG_REGISTER("includes/raw", includes_raw);
+DPSG_REGISTER("includes/strong", includes_strong);
+DPSG_REGISTER("merge/raw", merge_raw);
+DPSG_REGISTER("merge/strong", merge_strong);
+DPSG_REGISTER("count/raw", count_raw);
+DPSG_REGISTER("count/strong", count_strong);
+
+#undef DPSG_REGISTER
+
+}  // namespace
@@ -1,3 +1,4 @@
+#include <bit>
 #include <iostream>
 #include <strong_types.hpp>
 #include <span>
@@ -20,50 +21,40 @@ struct flag : st::flag_derivation<
   constexpr flag() : value{flag_values::z} {}
 };
 
+// The enumerators a to f are the bits 0 to 5
+char letter_of(flag_values value) {
+  return static_cast<char>('a' + std::countr_zero(static_cast<unsigned>(value)));
+}
+
 int main(int argc, const char** argv) {
   std::span<const char*> args(argv + 1, argc - 1);
   flag f{};
   for (std::string_view arg : args) {
-    if (arg == "a") {
-      std::cerr << "adding a\n";
-      f |= flag::a;
-    } else if (arg == "b") {
-      std::cerr << "adding b\n";
-      f |= flag::b;
-    } else if (arg == "c") {
-      std::cerr << "adding c\n";
-      f |= flag::c;
-    } else if (arg == "d") {
-      std::cerr << "adding d\n";
-      f |= flag::d;
-    } else if (arg == "e") {
-      std::cerr << "adding e\n";
-      f |= flag::e;
-    } else if (arg == "f") {
-      std::cerr << "adding f\n";
-      f |= flag::f;
-    } else if (arg == "!a") {
-      std::cerr << "removing a\n";
-      // Unfortunately we need to cast the flag_value to the wrapper type
-      f &= ~flag{flag::a};
-    } else if (arg == "!b") {
-      std::cerr << "removing b\n";
-      f &= ~flag{flag::b};
-    } else if (arg == "!c") {
-      std::cerr << "removing c\n";
-      f &= ~flag{flag::c};
-    } else if (arg == "!d") {
-      std::cerr << "removing d\n";
-      f &= ~flag{flag::d};
-    } else if (arg == "!e") {
-      std::cerr << "removing e\n";
-      f &= ~flag{flag::e};
-    } else if (arg == "!f") {
-      std::cerr << "removing f\n";
-      f &= ~flag{flag::f};
-    } else {
+    const bool remove = arg.starts_with('!');
+    if (remove) {
+      arg.remove_prefix(1);
+    }
+    bool known = false;
+    for (flag_values value : st::enumerators<flag_values>()) {
+      if (arg.size() == 1 && arg[0] == letter_of(value)) {
+        known = true;
+        if (remove) {
+          std::cerr << "removing " << arg << '\n';
+          // Unfortunately we need to cast the flag_value to the wrapper type
+          f &= ~flag{value};
+        } else {
+          std::cerr << "adding " << arg << '\n';
+          f |= value;
+        }
+      }
+    }
+    if (!known) {
       std::cerr << "unknown flag: '" << arg << "'\n";
     }
   }
-  std::cout << f << '\n';
+  std::cout << f << " (" << st::count(f) << " set:";
+  st::for_each_set_bit(f, [](flag_values value) {
+    std::cout << ' ' << letter_of(value);
+  });
+  std::cout << ")\n";
 }
@@ -4,6 +4,15 @@
 #include <type_traits>
 #include <utility>
 
+// MSVC only applies the empty base optimization to the first base class unless
+// asked otherwise. Strong types derive from many empty classes (one per set of
+// operations) and must keep the size of their value.
+#if defined(_MSC_VER)
+#define DPSG_STRONG_TYPES_EMPTY_BASES __declspec(empty_bases)
+#else
+#define DPSG_STRONG_TYPES_EMPTY_BASES
+#endif
+
 namespace dpsg {
 namespace strong_types {
 
@@ -72,10 +81,12 @@ struct cast_to_then_construct_t {
   }
 };
 
+/// Forward lvalues as references, and return rvalues (usually the result of the
+/// operation) by value so that they do not outlive the operator call.
 struct passthrough_t : detail::implement_ignored_values<passthrough_t> {
   using detail::implement_ignored_values<passthrough_t>::operator();
   template <class T>
-  inline constexpr decltype(auto) operator()(T&& t) const noexcept {
+  inline constexpr T operator()(T&& t) const noexcept {
     return std::forward<T>(t);
   }
 };
@@ -105,7 +116,8 @@ using concat_tuples_t = typename concat_tuples<T1, T2>::type;
 template <class T, class U>
 struct for_each;
 template <class U, class... Ts>
-struct for_each<tuple<Ts...>, U> : U::template type<Ts>... {};
+struct DPSG_STRONG_TYPES_EMPTY_BASES for_each<tuple<Ts...>, U>
+    : U::template type<Ts>... {};
 
 template <template <class...> class S, class... Ts>
 struct apply {
@@ -208,118 +220,329 @@ struct post_decrement {
 };
 
 namespace detail {
+template <class...>
+struct conjunction : std::true_type {};
+template <class B, class... Bs>
+struct conjunction<B, Bs...>
+    : std::conditional_t<B::value, conjunction<Bs...>, B> {};
+
+template <class T, class... Ts>
+struct contains
+    : std::integral_constant<
+          bool,
+          !std::is_same<
+              std::integer_sequence<bool, false, std::is_same<T, Ts>::value...>,
+              std::integer_sequence<bool, std::is_same<T, Ts>::value..., false>>::
+              value> {};
+
+// Position of T in Ts, which must contain it once
+template <class T, class... Ts>
+struct position_of;
+template <class T, class... Ts>
+struct position_of<T, T, Ts...> : std::integral_constant<std::size_t, 0> {
+  static_assert(!contains<T, Ts...>::value,
+                "the type appears several times, use its index");
+};
+template <class T, class U, class... Ts>
+struct position_of<T, U, Ts...>
+    : std::integral_constant<std::size_t, 1 + position_of<T, Ts...>::value> {};
+
+template <class Op>
+struct is_binary_operator : std::false_type {};
+template <class Op>
+struct is_unary_operator : std::false_type {};
+
+#define DPSG_DEFINE_BINARY_OPERATOR_TRAIT(op, sym) \
+  template <>                                     \
+  struct is_binary_operator<op> : std::true_type {};
+#define DPSG_DEFINE_UNARY_OPERATOR_TRAIT(op, sym) \
+  template <>                                    \
+  struct is_unary_operator<op> : std::true_type {};
+
+DPSG_APPLY_TO_BINARY_OPERATORS(DPSG_DEFINE_BINARY_OPERATOR_TRAIT)
+DPSG_APPLY_TO_SELF_ASSIGNING_BINARY_OPERATORS(DPSG_DEFINE_BINARY_OPERATOR_TRAIT)
+DPSG_APPLY_TO_UNARY_OPERATORS(DPSG_DEFINE_UNARY_OPERATOR_TRAIT)
+DPSG_DEFINE_UNARY_OPERATOR_TRAIT(post_increment, ++)
+DPSG_DEFINE_UNARY_OPERATOR_TRAIT(post_decrement, --)
+
+#undef DPSG_DEFINE_UNARY_OPERATOR_TRAIT
+#undef DPSG_DEFINE_BINARY_OPERATOR_TRAIT
+
+template <class T, class Expected>
+struct is_same_or_derived
+    : std::integral_constant<
+          bool,
+          std::is_same<std::decay_t<T>, Expected>::value ||
+              std::is_base_of<Expected, std::decay_t<T>>::value> {};
+
+template <class Expected,
+          class T,
+          std::enable_if_t<is_same_or_derived<T, Expected>::value, int> = 0>
+constexpr T&& as_operand(T&& t) noexcept {
+  return std::forward<T>(t);
+}
+template <class Expected,
+          class T,
+          std::enable_if_t<!is_same_or_derived<T, Expected>::value, int> = 0>
+constexpr Expected as_operand(T&& t) noexcept {
+  return std::forward<T>(t);
+}
+
+// Transformations are applied to the operands left to right, in separate
+// statements, so that the operation is evaluated in the same order as it would
+// be on the underlying values. Rvalue operands are forwarded, so that the
+// operation can reuse their values (the result functor may then receive
+// moved-from operands).
 template <class Op,
+          class Result,
+          class TransformLeft,
+          class TransformRight,
+          class Left,
+          class Right>
+constexpr decltype(auto) apply_binary_operation(Left&& left, Right&& right) {
+  auto&& l = TransformLeft{}(std::forward<Left>(left));
+  auto&& r = TransformRight{}(std::forward<Right>(right));
+  return Result{}(
+      Op{}(std::forward<decltype(l)>(l), std::forward<decltype(r)>(r)),
+      left,
+      right);
+}
+
+/// Implementation of the operations of a set, once the set has been selected.
+template <class Left,
+          class Right,
+          class Result,
+          class TransformLeft,
+          class TransformRight>
+struct binary_operation {
+  using left_type = Left;
+
+  template <class Op, class L, class R>
+  static constexpr decltype(auto) apply(L&& left, R&& right) {
+    return apply_binary_operation<Op, Result, TransformLeft, TransformRight>(
+        as_operand<Left>(std::forward<L>(left)),
+        as_operand<Right>(std::forward<R>(right)));
+  }
+
+  // Self assigning operations modify the value of the left operand in place,
+  // there is no result to build. The converted operand is held in a local, the
+  // transformation may return a reference to it.
+  template <class Op, class L, class R>
+  static constexpr void assign(L& left, R&& right) {
+    auto&& l = TransformLeft{}(left);
+    auto&& operand = as_operand<Right>(std::forward<R>(right));
+    auto&& r = TransformRight{}(std::forward<decltype(operand)>(operand));
+    Op{}(std::forward<decltype(l)>(l), std::forward<decltype(r)>(r));
+  }
+};
+
+template <class Arg, class Result, class Transform>
+struct unary_operation {
+  using argument_type = Arg;
+
+  template <class Op, class T>
+  static constexpr decltype(auto) apply(T&& arg) {
+    return Result{}(Op{}(Transform{}(std::forward<T>(arg))));
+  }
+};
+
+// Sets of operations declare a friend selection function taking their operands
+// and a pointer to the list of operations they implement. An
+// operation_query<Op> converts to that pointer only if Op is in the list, so
+// overload resolution on the selection functions picks the set implementing Op
+// whose operands best match the arguments, as it would among plain overloads.
+// Because they are never called, the selection functions generate no code.
+void select_binary_operation();
+void select_unary_operation();
+
+template <class Op>
+struct operation_query {
+  template <class... Ops,
+            std::enable_if_t<contains<Op, Ops...>::value, int> = 0>
+  constexpr operator black_magic::tuple<Ops...>*() const noexcept {
+    return nullptr;
+  }
+};
+
+template <class Op, class L, class R, class = void>
+struct selected_binary_operation {};
+template <class Op, class L, class R>
+struct selected_binary_operation<
+    Op,
+    L,
+    R,
+    void_t<decltype(select_binary_operation(std::declval<L>(),
+                                            std::declval<R>(),
+                                            operation_query<Op>{}))>> {
+  using type = std::remove_pointer_t<decltype(select_binary_operation(
+      std::declval<L>(),
+      std::declval<R>(),
+      operation_query<Op>{}))>;
+};
+
+template <class Op, class T, class = void>
+struct selected_unary_operation {};
+template <class Op, class T>
+struct selected_unary_operation<
+    Op,
+    T,
+    void_t<decltype(select_unary_operation(std::declval<T>(),
+                                           operation_query<Op>{}))>> {
+  using type = std::remove_pointer_t<decltype(
+      select_unary_operation(std::declval<T>(), operation_query<Op>{}))>;
+};
+
+template <class Op, class L, class R>
+using binary_operation_t = typename selected_binary_operation<Op, L, R>::type;
+
+// Self assigning operators modify their left operand in place, which must be
+// a non-const lvalue of the type expected by the operation.
+template <class Op,
+          class L,
+          class R,
+          class Operation = binary_operation_t<Op, L&, R>>
+using self_assign_operation_t = std::enable_if_t<
+    !std::is_const<L>::value &&
+        is_same_or_derived<L, typename Operation::left_type>::value,
+    Operation>;
+
+// Unary operators apply only to the type of the set (or types derived from it)
+template <class Op,
+          class T,
+          class Operation = typename selected_unary_operation<Op, T>::type>
+using unary_operation_t = std::enable_if_t<
+    is_same_or_derived<T, typename Operation::argument_type>::value,
+    Operation>;
+
+// Each operator is a single function template, found through argument
+// dependent lookup since the sets of operations are base classes of the strong
+// types, and enabled only when one of the sets implements it for the arguments.
+#define DPSG_DEFINE_BINARY_OPERATOR_IMPLEMENTATION(op, sym)                   \
+  template <class L, class R, class Operation = binary_operation_t<op, L, R>> \
+  constexpr decltype(auto) operator sym(L&& left, R&& right) {                \
+    return Operation::template apply<op>(std::forward<L>(left),               \
+                                         std::forward<R>(right));             \
+  }
+
+#define DPSG_DEFINE_SELF_ASSIGN_BINARY_OPERATOR_IMPLEMENTATION(op, sym) \
+  template <class L,                                                   \
+            class R,                                                   \
+            class Operation = self_assign_operation_t<op, L, R>>       \
+  constexpr L& operator sym(L& left, R&& right) {                      \
+    Operation::template assign<op>(left, std::forward<R>(right));      \
+    return left;                                                       \
+  }
+
+#define DPSG_DEFINE_UNARY_OPERATOR_IMPLEMENTATION(op, sym)       \
+  template <class T, class Operation = unary_operation_t<op, T>> \
+  constexpr decltype(auto) operator sym(T&& arg) {               \
+    return Operation::template apply<op>(std::forward<T>(arg));  \
+  }
+
+DPSG_APPLY_TO_BINARY_OPERATORS(DPSG_DEFINE_BINARY_OPERATOR_IMPLEMENTATION)
+DPSG_APPLY_TO_SELF_ASSIGNING_BINARY_OPERATORS(
+    DPSG_DEFINE_SELF_ASSIGN_BINARY_OPERATOR_IMPLEMENTATION)
+DPSG_APPLY_TO_UNARY_OPERATORS(DPSG_DEFINE_UNARY_OPERATOR_IMPLEMENTATION)
+
+#undef DPSG_DEFINE_UNARY_OPERATOR_IMPLEMENTATION
+#undef DPSG_DEFINE_SELF_ASSIGN_BINARY_OPERATOR_IMPLEMENTATION
+#undef DPSG_DEFINE_BINARY_OPERATOR_IMPLEMENTATION
+
+template <class T,
+          class Operation = unary_operation_t<post_increment, T>,
+          std::enable_if_t<!std::is_const<T>::value, int> = 0>
+constexpr decltype(auto) operator++(T& arg, int) {
+  return Operation::template apply<post_increment>(arg);
+}
+
+template <class T,
+          class Operation = unary_operation_t<post_decrement, T>,
+          std::enable_if_t<!std::is_const<T>::value, int> = 0>
+constexpr decltype(auto) operator--(T& arg, int) {
+  return Operation::template apply<post_decrement>(arg);
+}
+
+template <class Operations,
           class Left,
           class Right,
           class Result = passthrough_t,
           class TransformLeft = get_value_t,
           class TransformRight = get_value_t>
-struct implement_binary_operation;
+struct implement_binary_operations;
 
-template <class Op,
+template <class Operations,
           class Arg,
           class Result = passthrough_t,
           class Transform = get_value_t>
-struct implement_unary_operation;
-
-#define DPSG_DEFINE_FRIEND_BINARY_OPERATOR_IMPLEMENTATION(op, sym)            \
-  template <class Left,                                                       \
-            class Right,                                                      \
-            class Result,                                                     \
-            class TransformLeft,                                              \
-            class TransformRight>                                             \
-  struct implement_binary_operation<op,                                       \
-                                    Left,                                     \
-                                    Right,                                    \
-                                    Result,                                   \
-                                    TransformLeft,                            \
-                                    TransformRight> {                         \
-    friend constexpr decltype(auto) operator sym(const Left& left,            \
-                                                 const Right& right) {        \
-      return Result{}(                                                        \
-          op{}(TransformLeft{}(left), TransformRight{}(right)), left, right); \
-    }                                                                         \
-    friend constexpr decltype(auto) operator sym(Left& left,                  \
-                                                 const Right& right) {        \
-      return Result{}(                                                        \
-          op{}(TransformLeft{}(left), TransformRight{}(right)), left, right); \
-    }                                                                         \
-    friend constexpr decltype(auto) operator sym(const Left& left,            \
-                                                 Right& right) {              \
-      return Result{}(                                                        \
-          op{}(TransformLeft{}(left), TransformRight{}(right)), left, right); \
-    }                                                                         \
-    friend constexpr decltype(auto) operator sym(Left& left, Right& right) {  \
-      return Result{}(                                                        \
-          op{}(TransformLeft{}(left), TransformRight{}(right)), left, right); \
-    }                                                                         \
-  };
-
-#define DPSG_DEFINE_FRIEND_SELF_ASSIGN_BINARY_OPERATOR_IMPLEMENTATION(op, sym) \
-  template <class Left,                                                        \
-            class Right,                                                       \
-            class Result,                                                      \
-            class TransformLeft,                                               \
-            class TransformRight>                                              \
-  struct implement_binary_operation<op,                                        \
-                                    Left,                                      \
-                                    Right,                                     \
-                                    Result,                                    \
-                                    TransformLeft,                             \
-                                    TransformRight> {                          \
-    template <                                                                 \
-        class T,                                                               \
-        std::enable_if_t<std::is_same<std::decay_t<T>, Left>::value, int> = 0> \
-    friend constexpr decltype(auto) operator sym(T& left,                      \
-                                                 const Right& right) {         \
-      return Result{}(                                                         \
-          op{}(TransformLeft{}(left), TransformRight{}(right)), left, right);  \
-    }                                                                          \
-  };
-
-#define DPSG_DEFINE_FRIEND_UNARY_OPERATOR_IMPLEMENTATION(op, sym)             \
-  template <class Arg, class Result, class Transform>                         \
-  struct implement_unary_operation<op, Arg, Result, Transform> {              \
-    template <                                                                \
-        class T,                                                              \
-        std::enable_if_t<std::is_same<std::decay_t<T>, Arg>::value, int> = 0> \
-    friend constexpr decltype(auto) operator sym(T&& arg) {                   \
-      return Result{}(op{}(Transform{}(std::forward<T>(arg))));               \
-    }                                                                         \
-  };
+struct implement_unary_operations;
 
-template <class L, class R, class TL>
-struct implement_unary_operation<post_increment, L, R, TL> {
-  template <class T,
-            std::enable_if_t<std::is_same<std::decay_t<T>, L>::value, int> = 0>
-  friend constexpr decltype(auto) operator++(T& left, int) {
-    post_increment{}(TL{}(left));
-    return left;
+/// Implements every operation of Ops between Left and Right with a single
+/// class. The operators themselves are shared by all the sets.
+template <class... Ops,
+          class Left,
+          class Right,
+          class Result,
+          class TransformLeft,
+          class TransformRight>
+struct implement_binary_operations<black_magic::tuple<Ops...>,
+                                   Left,
+                                   Right,
+                                   Result,
+                                   TransformLeft,
+                                   TransformRight> {
+  static_assert(conjunction<is_binary_operator<Ops>...>::value,
+                "implement_binary_operations expects binary operators");
+
+  friend constexpr binary_operation<Left,
+                                    Right,
+                                    Result,
+                                    TransformLeft,
+                                    TransformRight>*
+  select_binary_operation(const Left&,
+                          const Right&,
+                          black_magic::tuple<Ops...>*) noexcept {
+    return nullptr;
   }
 };
 
-template <class L, class R, class TL>
-struct implement_unary_operation<post_decrement, L, R, TL> {
-  template <class T,
-            std::enable_if_t<std::is_same<std::decay_t<T>, L>::value, int> = 0>
-  friend constexpr decltype(auto) operator--(T& left, int) {
-    post_decrement{}(TL{}(left));
-    return left;
+/// Implements every operation of Ops on Arg with a single class.
+template <class... Ops, class Arg, class Result, class Transform>
+struct implement_unary_operations<black_magic::tuple<Ops...>,
+                                  Arg,
+                                  Result,
+                                  Transform> {
+  static_assert(conjunction<is_unary_operator<Ops>...>::value,
+                "implement_unary_operations expects unary operators");
+
+  friend constexpr unary_operation<Arg, Result, Transform>*
+  select_unary_operation(const Arg&, black_magic::tuple<Ops...>*) noexcept {
+    return nullptr;
   }
 };
 
-DPSG_APPLY_TO_BINARY_OPERATORS(
-    DPSG_DEFINE_FRIEND_BINARY_OPERATOR_IMPLEMENTATION)
-DPSG_APPLY_TO_SELF_ASSIGNING_BINARY_OPERATORS(
-    DPSG_DEFINE_FRIEND_SELF_ASSIGN_BINARY_OPERATOR_IMPLEMENTATION)
-DPSG_APPLY_TO_UNARY_OPERATORS(DPSG_DEFINE_FRIEND_UNARY_OPERATOR_IMPLEMENTATION)
-
-#undef DPSG_DEFINE_FRIEND_UNARY_OPERATOR_IMPLEMENTATION
-#undef DPSG_DEFINE_FRIEND_SELF_ASSIGN_BINARY_OPERATOR_IMPLEMENTATION
-#undef DPSG_DEFINE_FRIEND_BINARY_OPERATOR_IMPLEMENTATION
-
 }  // namespace detail
 
+template <class Operations,
+          class Left,
+          class Right,
+          class Result = passthrough_t,
+          class TransformLeft = get_value_t,
+          class TransformRight = get_value_t>
+using implement_binary_operations =
+    detail::implement_binary_operations<Operations,
+                                        Left,
+                                        Right,
+                                        Result,
+                                        TransformLeft,
+                                        TransformRight>;
+
+template <class Operations,
+          class Arg,
+          class Result = passthrough_t,
+          class Transform = get_value_t>
+using implement_unary_operations =
+    detail::implement_unary_operations<Operations, Arg, Result, Transform>;
+
 template <class Op,
           class Left,
           class Right,
@@ -327,19 +550,19 @@ template <class Op,
           class TransformLeft = get_value_t,
           class TransformRight = get_value_t>
 using implement_binary_operation =
-    detail::implement_binary_operation<Op,
-                                       Left,
-                                       Right,
-                                       Result,
-                                       TransformLeft,
-                                       TransformRight>;
+    implement_binary_operations<black_magic::tuple<Op>,
+                                Left,
+                                Right,
+                                Result,
+                                TransformLeft,
+                                TransformRight>;
 
 template <class Op,
           class Arg,
           class Result = passthrough_t,
           class Transform = get_value_t>
 using implement_unary_operation =
-    detail::implement_unary_operation<Op, Arg, Result, Transform>;
+    implement_unary_operations<black_magic::tuple<Op>, Arg, Result, Transform>;
 
 template <class Operation,
           class Arg,
@@ -352,6 +575,26 @@ struct implement_symmetric_operation : implement_binary_operation<Operation,
                                                                   Transform,
                                                                   Transform> {};
 
+template <class Operations,
+          class Left,
+          class Right,
+          class Return = passthrough_t,
+          class TransformLeft = get_value_t,
+          class TransformRight = get_value_t>
+struct DPSG_STRONG_TYPES_EMPTY_BASES implement_commutative_operations
+    : implement_binary_operations<Operations,
+                                  Left,
+                                  Right,
+                                  Return,
+                                  TransformLeft,
+                                  TransformRight>,
+      implement_binary_operations<Operations,
+                                  Right,
+                                  Left,
+                                  Return,
+                                  TransformRight,
+                                  TransformLeft> {};
+
 template <class Operation,
           class Left,
           class Right,
@@ -359,18 +602,12 @@ template <class Operation,
           class TransformLeft = get_value_t,
           class TransformRight = get_value_t>
 struct implement_commutative_operation
-    : implement_binary_operation<Operation,
-                                 Left,
-                                 Right,
-                                 Return,
-                                 TransformLeft,
-                                 TransformRight>,
-      implement_binary_operation<Operation,
-                                 Right,
-                                 Left,
-                                 Return,
-                                 TransformRight,
-                                 TransformLeft> {};
+    : implement_commutative_operations<black_magic::tuple<Operation>,
+                                       Left,
+                                       Right,
+                                       Return,
+                                       TransformLeft,
+                                       TransformRight> {};
 
 using comparison_operators = black_magic::
     tuple<equal, not_equal, lesser_equal, greater_equal, lesser, greater>;
@@ -428,12 +665,20 @@ struct make_commutative_operator {
 template <class Arg, class R = black_magic::deduce, class T = get_value_t>
 struct make_symmetric_operator {
   template <class Op>
-  using type = implement_symmetric_operation<Op, Arg, R, T>;
+  using type = implement_symmetric_operation<
+      Op,
+      Arg,
+      black_magic::deduce_return_type<R, construct_t<Arg>, Arg>,
+      T>;
 };
 template <class Arg, class R = black_magic::deduce, class T = get_value_t>
 struct make_unary_operator {
   template <class Op>
-  using type = implement_unary_operation<Op, Arg, R, T>;
+  using type = implement_unary_operation<
+      Op,
+      Arg,
+      black_magic::deduce_return_type<R, construct_t<Arg>, Arg>,
+      T>;
 };
 template <class Left,
           class Right,
@@ -442,41 +687,77 @@ template <class Left,
           class TR = get_value_t>
 struct make_binary_operator {
   template <class Op>
-  using type = implement_binary_operation<Op, Left, Right, R, TL, TR>;
+  using type = implement_binary_operation<
+      Op,
+      Left,
+      Right,
+      black_magic::deduce_return_type<R, construct_t<Left>, Left>,
+      TL,
+      TR>;
 };
 
+namespace black_magic {
+// for_each over the operator factories above collapses into a single set of
+// operations instead of one base class per operator.
+template <class... Ops, class Arg1, class Arg2, class R, class T1, class T2>
+struct for_each<tuple<Ops...>, make_commutative_operator<Arg1, Arg2, R, T1, T2>>
+    : implement_commutative_operations<tuple<Ops...>, Arg1, Arg2, R, T1, T2> {
+};
+template <class... Ops, class Arg, class R, class T>
+struct for_each<tuple<Ops...>, make_symmetric_operator<Arg, R, T>>
+    : implement_binary_operations<
+          tuple<Ops...>,
+          Arg,
+          Arg,
+          deduce_return_type<R, construct_t<Arg>, Arg>,
+          T,
+          T> {};
+template <class... Ops, class Arg, class R, class T>
+struct for_each<tuple<Ops...>, make_unary_operator<Arg, R, T>>
+    : implement_unary_operations<tuple<Ops...>,
+                                 Arg,
+                                 deduce_return_type<R, construct_t<Arg>, Arg>,
+                                 T> {};
+template <class... Ops, class Left, class Right, class R, class TL, class TR>
+struct for_each<tuple<Ops...>, make_binary_operator<Left, Right, R, TL, TR>>
+    : implement_binary_operations<
+          tuple<Ops...>,
+          Left,
+          Right,
+          deduce_return_type<R, construct_t<Left>, Left>,
+          TL,
+          TR> {};
+}  // namespace black_magic
+
 struct comparable {
   template <class Arg>
-  struct type
-      : black_magic::for_each<
-            comparison_operators,
-            make_symmetric_operator<
-                Arg,
-                construct_t<bool> /* passthrough causes rt errors on MSVC */>> {
-  };
+  using type = implement_binary_operations<
+      comparison_operators,
+      Arg,
+      Arg,
+      construct_t<bool> /* passthrough causes rt errors on MSVC */>;
 };
 
 template <class Arg2>
 struct comparable_with {
   template <class Arg1>
-  struct type
-      : black_magic::for_each<
-            comparison_operators,
-            make_commutative_operator<
-                Arg1,
-                Arg2,
-                construct_t<bool> /* passthrough causes rt errors on MSVC */>> {
-  };
+  using type = implement_commutative_operations<
+      comparison_operators,
+      Arg1,
+      Arg2,
+      construct_t<bool> /* passthrough causes rt errors on MSVC */>;
 };
 
 struct arithmetic {
   template <class Arg>
-  struct type
-      : black_magic::for_each<binary_arithmetic_operators,
-                              make_symmetric_operator<Arg, construct_t<Arg>>>,
-        black_magic::for_each<
-            unary_arithmetic_operators,
-            make_unary_operator<Arg, construct_t<Arg>, get_value_t>> {};
+  struct DPSG_STRONG_TYPES_EMPTY_BASES type
+      : implement_binary_operations<binary_arithmetic_operators,
+                                    Arg,
+                                    Arg,
+                                    construct_t<Arg>>,
+        implement_unary_operations<unary_arithmetic_operators,
+                                   Arg,
+                                   construct_t<Arg>> {};
 };
 
 template <class Op,
@@ -484,8 +765,13 @@ template <class Op,
           class Transform = get_value_t>
 struct symmetric {
   template <class T>
-  using type =
-      implement_binary_operation<Op, T, T, Return, Transform, Transform>;
+  using type = implement_binary_operation<
+      Op,
+      T,
+      T,
+      black_magic::deduce_return_type<Return, construct_t<T>, T>,
+      Transform,
+      Transform>;
 };
 
 template <class Arg2,
@@ -494,15 +780,13 @@ template <class Arg2,
           class T2 = get_value_t>
 struct arithmetically_compatible_with {
   template <class Arg1>
-  struct type
-      : black_magic::for_each<
-            binary_arithmetic_operators,
-            make_commutative_operator<
-                Arg1,
-                Arg2,
-                black_magic::deduce_return_type<R, construct_t<Arg1>, Arg1>,
-                T1,
-                T2>> {};
+  using type = implement_commutative_operations<
+      binary_arithmetic_operators,
+      Arg1,
+      Arg2,
+      black_magic::deduce_return_type<R, construct_t<Arg1>, Arg1>,
+      T1,
+      T2>;
 };
 
 template <class Op,
@@ -539,10 +823,14 @@ struct compatible_under {
 
 struct bitwise {
   template <class Type>
-  struct type : black_magic::for_each<binary_bitwise_operators,
-                                      make_symmetric_operator<Type>>,
-                black_magic::for_each<unary_bitwise_operators,
-                                      make_unary_operator<Type>> {};
+  struct DPSG_STRONG_TYPES_EMPTY_BASES type
+      : implement_binary_operations<binary_bitwise_operators,
+                                    Type,
+                                    Type,
+                                    construct_t<Type>>,
+        implement_unary_operations<unary_bitwise_operators,
+                                   Type,
+                                   construct_t<Type>> {};
 };
 
 template <class Arg2,
@@ -551,22 +839,27 @@ template <class Arg2,
           class T2 = get_value_t>
 struct bitwise_compatible_with {
   template <class Arg1>
-  struct type
-      : black_magic::for_each<
-            binary_bitwise_operators,
-            make_commutative_operator<
-                Arg1,
-                Arg2,
-                black_magic::deduce_return_type<R, construct_t<Arg1>, Arg1>,
-                T1,
-                T2>> {};
+  using type = implement_commutative_operations<
+      binary_bitwise_operators,
+      Arg1,
+      Arg2,
+      black_magic::deduce_return_type<R, construct_t<Arg1>, Arg1>,
+      T1,
+      T2>;
 };
 
 template <class T, class... Ts>
-struct derive_t : Ts::template type<T>... {};
+struct DPSG_STRONG_TYPES_EMPTY_BASES derive_t : Ts::template type<T>... {};
+
+/// Tag selecting the constructor of strong_value building the value in place
+struct in_place_t {
+  explicit in_place_t() = default;
+};
+constexpr in_place_t in_place{};
 
 template <class Type, class Tag, class... Params>
-struct strong_value : derive_t<strong_value<Type, Tag, Params...>, Params...> {
+struct DPSG_STRONG_TYPES_EMPTY_BASES strong_value
+    : derive_t<strong_value<Type, Tag, Params...>, Params...> {
   using value_type = Type;
 
   template <
@@ -575,13 +868,21 @@ struct strong_value : derive_t<strong_value<Type, Tag, Params...>, Params...> {
                        int> = 0>
   constexpr explicit strong_value(U&& u) noexcept : value{std::forward<U>(u)} {}
 
+  /// Constructs the value from args, without any intermediate value
+  template <class... Args,
+            std::enable_if_t<std::is_constructible<value_type, Args...>::value,
+                             int> = 0>
+  constexpr explicit strong_value(in_place_t, Args&&... args) noexcept(
+      std::is_nothrow_constructible<value_type, Args...>::value)
+      : value(std::forward<Args>(args)...) {}
+
   constexpr strong_value() noexcept : value{} {}
 
   value_type value;
 };
 
 template <class Type, class Tag, class... Params>
-struct number
+struct DPSG_STRONG_TYPES_EMPTY_BASES number
     : derive_t<number<Type, Tag, Params...>,
                arithmetic,
                comparable,
@@ -606,6 +907,48 @@ struct number
   value_type value;
 };
 
+/// A strong type is layout compatible with its value_type if it has the same
+/// size and alignment, and if it is trivially copyable and standard layout
+/// whenever its value_type is. An array of such strong types can be viewed as
+/// an array of their values and back (see strong_types/layout.hpp).
+namespace detail {
+template <class T>
+using value_of_t = std::decay_t<decltype(std::declval<T&>().value)>;
+}  // namespace detail
+
+template <class T, class Value = detail::value_of_t<T>>
+struct is_layout_compatible_with_value
+    : std::integral_constant<
+          bool,
+          sizeof(T) == sizeof(Value) && alignof(T) == alignof(Value) &&
+              (!std::is_trivially_copyable<Value>::value ||
+               std::is_trivially_copyable<T>::value) &&
+              (!std::is_standard_layout<Value>::value ||
+               std::is_standard_layout<T>::value)> {};
+template <class T>
+constexpr bool is_layout_compatible_with_value_v =
+    is_layout_compatible_with_value<T>::value;
+
+namespace detail {
+// The operation sets are empty and distinct, deriving from any number of them
+// must not change the layout of a strong type.
+static_assert(
+    is_layout_compatible_with_value_v<strong_value<int, struct layout_tag>>,
+    "strong_value must be layout compatible with its value");
+static_assert(is_layout_compatible_with_value_v<
+                  strong_value<double, struct layout_tag, arithmetic, comparable>>,
+              "strong_value must be layout compatible with its value");
+static_assert(is_layout_compatible_with_value_v<number<char, struct layout_tag>>,
+              "number must be layout compatible with its value");
+static_assert(is_layout_compatible_with_value_v<
+                  number<unsigned long long,
+                         struct layout_tag,
+                         bitwise,
+                         comparable_with<int>,
+                         arithmetically_compatible_with<long>>>,
+              "number must be layout compatible with its value");
+}  // namespace detail
+
 }  // namespace strong_types
 }  // namespace dpsg
 
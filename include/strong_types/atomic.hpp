@@ -0,0 +1,419 @@
+#ifndef GUARD_DPSG_STRONG_TYPES_ATOMIC_HPP
+#define GUARD_DPSG_STRONG_TYPES_ATOMIC_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+
+#include <strong_types.hpp>
+#include <strong_types/flags.hpp>
+#include <strong_types/layout.hpp>
+
+namespace dpsg {
+namespace strong_types {
+
+namespace detail {
+// Accepts the enumerators and the flags of one flag type only, so that the
+// masks given to an atomic flag set are checked against its tag
+template <class Flag>
+struct flag_mask {
+  using enum_type = typename Flag::value_type;
+  using underlying_type = std::underlying_type_t<enum_type>;
+
+  constexpr flag_mask(enum_type e) noexcept
+      : bits{static_cast<underlying_type>(e)} {}
+  constexpr flag_mask(const Flag& f) noexcept
+      : bits{static_cast<underlying_type>(f.value)} {}
+
+  underlying_type bits;
+};
+
+// Failure orders can't release, the strongest one compatible with a success
+// order is used when only the latter is given, as std::atomic does
+constexpr std::memory_order failure_order(std::memory_order order) noexcept {
+  return order == std::memory_order_acq_rel   ? std::memory_order_acquire
+         : order == std::memory_order_release ? std::memory_order_relaxed
+                                              : order;
+}
+
+template <class T, class = void>
+struct is_integral_operand
+    : std::integral_constant<bool,
+                             std::is_integral<T>::value &&
+                                 !std::is_same<T, bool>::value> {};
+template <class T>
+struct is_integral_operand<T, void_t<value_of_t<T>>>
+    : is_integral_operand<value_of_t<T>> {};
+
+template <class Number, class U>
+using add_assign_t =
+    decltype(std::declval<Number&>() += std::declval<const U&>());
+template <class Number, class U>
+using subtract_assign_t =
+    decltype(std::declval<Number&>() -= std::declval<const U&>());
+
+struct add_assign {
+  template <class L, class R>
+  constexpr void operator()(L& left, const R& right) const {
+    left += right;
+  }
+  template <class T>
+  static T fetch(std::atomic<T>& value, T delta, std::memory_order order) {
+    return value.fetch_add(delta, order);
+  }
+};
+struct subtract_assign {
+  template <class L, class R>
+  constexpr void operator()(L& left, const R& right) const {
+    left -= right;
+  }
+  template <class T>
+  static T fetch(std::atomic<T>& value, T delta, std::memory_order order) {
+    return value.fetch_sub(delta, order);
+  }
+};
+}  // namespace detail
+
+/// Atomic set of flag<Enum, Tag, Args...>. The read-modify-write operations
+/// accept the enumerators of Enum and flags of the same type only, and return
+/// the flags held before the operation, like the member functions of
+/// std::atomic. The compound assignment operators of flag return the flags
+/// held after the operation.
+template <class Enum, class Tag, class... Args>
+class atomic_flag_set {
+ public:
+  using flag_type = flag<Enum, Tag, Args...>;
+  using mask_type = detail::flag_mask<flag_type>;
+  using underlying_type = std::underlying_type_t<Enum>;
+
+  constexpr atomic_flag_set() noexcept : bits_{0} {}
+  constexpr explicit atomic_flag_set(mask_type initial) noexcept
+      : bits_{initial.bits} {}
+
+  atomic_flag_set(const atomic_flag_set&) = delete;
+  atomic_flag_set& operator=(const atomic_flag_set&) = delete;
+
+  bool is_lock_free() const noexcept { return bits_.is_lock_free(); }
+
+  flag_type load(
+      std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    return to_flag(bits_.load(order));
+  }
+  void store(mask_type value,
+             std::memory_order order = std::memory_order_seq_cst) noexcept {
+    bits_.store(value.bits, order);
+  }
+  flag_type exchange(
+      mask_type value,
+      std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return to_flag(bits_.exchange(value.bits, order));
+  }
+
+  flag_type fetch_or(
+      mask_type mask,
+      std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return to_flag(bits_.fetch_or(mask.bits, order));
+  }
+  flag_type fetch_and(
+      mask_type mask,
+      std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return to_flag(bits_.fetch_and(mask.bits, order));
+  }
+  flag_type fetch_xor(
+      mask_type mask,
+      std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return to_flag(bits_.fetch_xor(mask.bits, order));
+  }
+
+  /// Sets the flags of the mask, and returns true if one of them was already
+  /// set (so that exactly one of the threads setting a flag gets false)
+  bool test_and_set(
+      mask_type mask,
+      std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return (bits_.fetch_or(mask.bits, order) & mask.bits) != 0;
+  }
+  /// Resets the flags of the mask, and returns true if one of them was set
+  bool test_and_reset(
+      mask_type mask,
+      std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return (bits_.fetch_and(static_cast<underlying_type>(~mask.bits), order) &
+            mask.bits) != 0;
+  }
+  /// True if every flag of the mask is set
+  bool test(mask_type mask,
+            std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    return (bits_.load(order) & mask.bits) == mask.bits;
+  }
+
+  bool compare_exchange_weak(flag_type& expected,
+                             mask_type desired,
+                             std::memory_order success,
+                             std::memory_order failure) noexcept {
+    underlying_type bits = static_cast<underlying_type>(expected.value);
+    const bool exchanged =
+        bits_.compare_exchange_weak(bits, desired.bits, success, failure);
+    expected = to_flag(bits);
+    return exchanged;
+  }
+  bool compare_exchange_weak(
+      flag_type& expected,
+      mask_type desired,
+      std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return compare_exchange_weak(expected, desired, order,
+                                 detail::failure_order(order));
+  }
+  bool compare_exchange_strong(flag_type& expected,
+                               mask_type desired,
+                               std::memory_order success,
+                               std::memory_order failure) noexcept {
+    underlying_type bits = static_cast<underlying_type>(expected.value);
+    const bool exchanged =
+        bits_.compare_exchange_strong(bits, desired.bits, success, failure);
+    expected = to_flag(bits);
+    return exchanged;
+  }
+  bool compare_exchange_strong(
+      flag_type& expected,
+      mask_type desired,
+      std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return compare_exchange_strong(expected, desired, order,
+                                   detail::failure_order(order));
+  }
+
+  flag_type operator|=(mask_type mask) noexcept {
+    return to_flag(static_cast<underlying_type>(bits_.fetch_or(mask.bits) |
+                                                mask.bits));
+  }
+  flag_type operator&=(mask_type mask) noexcept {
+    return to_flag(static_cast<underlying_type>(bits_.fetch_and(mask.bits) &
+                                                mask.bits));
+  }
+  flag_type operator^=(mask_type mask) noexcept {
+    return to_flag(static_cast<underlying_type>(bits_.fetch_xor(mask.bits) ^
+                                                mask.bits));
+  }
+
+ private:
+  static constexpr flag_type to_flag(underlying_type bits) noexcept {
+    return flag_type{static_cast<Enum>(bits)};
+  }
+
+  std::atomic<underlying_type> bits_;
+};
+
+/// Atomic number<T, Tag, Params...>. fetch_add and fetch_sub accept the
+/// operands accepted by the += and -= operators of the number (the number
+/// itself, and the types it is arithmetically_compatible_with), and return
+/// the number held before the operation. Integral operands added to integral
+/// numbers use the atomic instructions of the value type. Other operations
+/// (on floating point numbers, or with operands whose operation transforms
+/// the value) retry the operation of the number in a compare-exchange loop.
+template <class T, class Tag, class... Params>
+class atomic_number {
+ public:
+  using number_type = number<T, Tag, Params...>;
+  using value_type = T;
+
+  constexpr atomic_number() noexcept : value_{} {}
+  constexpr explicit atomic_number(number_type initial) noexcept
+      : value_{initial.value} {}
+
+  atomic_number(const atomic_number&) = delete;
+  atomic_number& operator=(const atomic_number&) = delete;
+
+  bool is_lock_free() const noexcept { return value_.is_lock_free(); }
+
+  number_type load(
+      std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    return number_type{value_.load(order)};
+  }
+  void store(number_type value,
+             std::memory_order order = std::memory_order_seq_cst) noexcept {
+    value_.store(value.value, order);
+  }
+  number_type exchange(
+      number_type value,
+      std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return number_type{value_.exchange(value.value, order)};
+  }
+
+  bool compare_exchange_weak(number_type& expected,
+                             number_type desired,
+                             std::memory_order success,
+                             std::memory_order failure) noexcept {
+    return value_.compare_exchange_weak(expected.value, desired.value,
+                                        success, failure);
+  }
+  bool compare_exchange_weak(
+      number_type& expected,
+      number_type desired,
+      std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return compare_exchange_weak(expected, desired, order,
+                                 detail::failure_order(order));
+  }
+  bool compare_exchange_strong(number_type& expected,
+                               number_type desired,
+                               std::memory_order success,
+                               std::memory_order failure) noexcept {
+    return value_.compare_exchange_strong(expected.value, desired.value,
+                                          success, failure);
+  }
+  bool compare_exchange_strong(
+      number_type& expected,
+      number_type desired,
+      std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return compare_exchange_strong(expected, desired, order,
+                                   detail::failure_order(order));
+  }
+
+  template <class U, class = detail::add_assign_t<number_type, U>>
+  number_type fetch_add(const U& delta,
+                        std::memory_order order = std::memory_order_seq_cst) {
+    return fetch_update<detail::add_assign>(delta, order);
+  }
+  template <class U, class = detail::subtract_assign_t<number_type, U>>
+  number_type fetch_sub(const U& delta,
+                        std::memory_order order = std::memory_order_seq_cst) {
+    return fetch_update<detail::subtract_assign>(delta, order);
+  }
+
+  /// The compound assignment operators return the new number
+  template <class U, class = detail::add_assign_t<number_type, U>>
+  number_type operator+=(const U& delta) {
+    number_type result = fetch_add(delta);
+    result += delta;
+    return result;
+  }
+  template <class U, class = detail::subtract_assign_t<number_type, U>>
+  number_type operator-=(const U& delta) {
+    number_type result = fetch_sub(delta);
+    result -= delta;
+    return result;
+  }
+
+  number_type operator++() { return *this += one(); }
+  number_type operator--() { return *this -= one(); }
+  number_type operator++(int) { return fetch_add(one()); }
+  number_type operator--(int) { return fetch_sub(one()); }
+
+ private:
+  static constexpr number_type one() noexcept {
+    return number_type{static_cast<T>(1)};
+  }
+
+  // Adding the operand to 0 gives the value to add or subtract with the
+  // atomic instruction, which preserves the result of the operation between
+  // integers (wrapping around included). += and -= share their operand
+  // transformations in the operation sets of numbers.
+  template <class Op, class U>
+  number_type fetch_update(const U& delta, std::memory_order order) {
+    return fetch_update<Op>(
+        delta, order,
+        std::integral_constant<bool,
+                               std::is_integral<T>::value &&
+                                   detail::is_integral_operand<U>::value>{});
+  }
+
+  template <class Op, class U>
+  number_type fetch_update(const U& delta,
+                           std::memory_order order,
+                           std::true_type /* atomic instruction */) {
+    number_type d{};
+    d += delta;
+    return number_type{Op::fetch(value_, d.value, order)};
+  }
+
+  template <class Op, class U>
+  number_type fetch_update(const U& delta,
+                           std::memory_order order,
+                           std::false_type /* compare-exchange loop */) {
+    T current = value_.load(std::memory_order_relaxed);
+    number_type next;
+    do {
+      next = number_type{current};
+      Op{}(next, delta);
+    } while (!value_.compare_exchange_weak(current, next.value, order,
+                                           detail::failure_order(order)));
+    return number_type{current};
+  }
+
+  std::atomic<T> value_;
+};
+
+namespace detail {
+// Threads are given consecutive indices the first time they ask for one
+// (constant initialization avoids the guard of dynamic thread_local
+// initialization on each call).
+inline std::size_t thread_index() noexcept {
+  static std::atomic<std::size_t> next{0};
+  static thread_local std::size_t index = 0;
+  if (index == 0) {
+    index = next.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+  return index - 1;
+}
+}  // namespace detail
+
+template <class Number, std::size_t Shards = 16>
+class sharded_counter;
+
+/// Counter split in Shards atomic numbers, each on its own cache line. Threads
+/// add to the shard of their thread index (consecutive threads use
+/// different shards), so that concurrent additions rarely touch the same cache
+/// line, and load() sums the shards. Additions are relaxed: load() sees every
+/// addition that happened before it, but the order in which the additions of
+/// different threads become visible is unspecified.
+template <class T, class Tag, class... Params, std::size_t Shards>
+class sharded_counter<number<T, Tag, Params...>, Shards> {
+  static_assert(Shards > 0 && (Shards & (Shards - 1)) == 0,
+                "the number of shards must be a power of 2");
+
+  struct alignas(cache_line_size) shard {
+    atomic_number<T, Tag, Params...> value;
+  };
+
+ public:
+  using number_type = number<T, Tag, Params...>;
+
+  constexpr sharded_counter() noexcept = default;
+
+  sharded_counter(const sharded_counter&) = delete;
+  sharded_counter& operator=(const sharded_counter&) = delete;
+
+  /// Accepts the operands of atomic_number::fetch_add
+  template <class U, class = detail::add_assign_t<number_type, U>>
+  void add(const U& delta) {
+    shards_[detail::thread_index() & (Shards - 1)].value.fetch_add(
+        delta, std::memory_order_relaxed);
+  }
+  template <class U, class = detail::subtract_assign_t<number_type, U>>
+  void subtract(const U& delta) {
+    shards_[detail::thread_index() & (Shards - 1)].value.fetch_sub(
+        delta, std::memory_order_relaxed);
+  }
+
+  number_type load() const noexcept {
+    number_type total{};
+    for (const shard& s : shards_) {
+      total += s.value.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  /// Sets every shard to 0 and returns the sum of their previous values
+  number_type reset() noexcept {
+    number_type total{};
+    for (shard& s : shards_) {
+      total += s.value.exchange(number_type{}, std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+ private:
+  shard shards_[Shards];
+};
+
+}  // namespace strong_types
+}  // namespace dpsg
+
+#endif  // GUARD_DPSG_STRONG_TYPES_ATOMIC_HPP
@@ -0,0 +1,342 @@
+#ifndef GUARD_DPSG_STRONG_TYPES_BINARY_HPP
+#define GUARD_DPSG_STRONG_TYPES_BINARY_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <strong_types.hpp>
+#include <strong_types/bits.hpp>
+#include <strong_types/layout.hpp>
+
+#if __has_include(<span>) && __cplusplus > 201703L
+#include <span>
+#endif
+
+// std::byte requires C++17
+#ifdef __cpp_lib_byte
+
+namespace dpsg {
+namespace strong_types {
+
+/// Byte order of serialized values. MSVC only targets little endian
+/// architectures.
+enum class endianness {
+  little,
+  big,
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  native = big
+#else
+  native = little
+#endif
+};
+
+/// Serializes the strong type in the given byte order with write, read,
+/// encode and decode.
+template <endianness Endianness>
+struct serializable {
+  template <class T>
+  struct type {
+    using serialized_endianness =
+        std::integral_constant<endianness, Endianness>;
+  };
+};
+
+namespace detail {
+namespace binary {
+
+template <std::size_t Size>
+struct word;
+template <>
+struct word<1> {
+  using type = std::uint8_t;
+};
+template <>
+struct word<2> {
+  using type = std::uint16_t;
+};
+template <>
+struct word<4> {
+  using type = std::uint32_t;
+};
+template <>
+struct word<8> {
+  using type = std::uint64_t;
+};
+
+template <class V>
+using word_t = typename word<sizeof(V)>::type;
+
+// bool is excluded: reading any byte but 0 or 1 would make an invalid bool
+template <class V>
+struct is_wire_value
+    : std::integral_constant<bool,
+                             (std::is_arithmetic<V>::value ||
+                              std::is_enum<V>::value) &&
+                                 !std::is_same<V, bool>::value &&
+                                 (sizeof(V) == 1 || sizeof(V) == 2 ||
+                                  sizeof(V) == 4 || sizeof(V) == 8)> {};
+
+// The value written for T: T itself for numbers and enums, the value of
+// strong types holding a number or an enum. Nothing for any other type.
+template <class T, class = void>
+struct wire_value {};
+template <class T>
+struct wire_value<T, std::enable_if_t<is_wire_value<T>::value>> {
+  using type = T;
+};
+template <class T>
+struct wire_value<
+    T,
+    std::enable_if_t<has_value<T>::value &&
+                     is_wire_value<value_of_t<T>>::value>> {
+  using type = value_of_t<T>;
+};
+template <class T>
+using wire_value_t = typename wire_value<T>::type;
+
+// The values of contiguous arrays of T are copied and swapped as a whole
+template <class T>
+struct has_contiguous_values
+    : std::integral_constant<bool,
+                             is_layout_compatible_with_value<T>::value &&
+                                 std::is_trivially_copyable<T>::value> {};
+template <class T>
+struct is_contiguous : std::conditional_t<is_wire_value<T>::value,
+                                          std::true_type,
+                                          has_contiguous_values<T>> {};
+
+template <class T, class = void>
+struct endianness_of {};
+template <class T>
+struct endianness_of<T, void_t<typename T::serialized_endianness>>
+    : T::serialized_endianness {};
+
+template <endianness Endianness, class V>
+void store(std::byte* out, V value) noexcept {
+  word_t<V> word;
+  std::memcpy(&word, &value, sizeof(word));
+  if (Endianness != endianness::native) {
+    word = byteswap(word);
+  }
+  std::memcpy(out, &word, sizeof(word));
+}
+
+template <endianness Endianness, class V>
+V load(const std::byte* in) noexcept {
+  word_t<V> word;
+  std::memcpy(&word, in, sizeof(word));
+  if (Endianness != endianness::native) {
+    word = byteswap(word);
+  }
+  V value;
+  std::memcpy(&value, &word, sizeof(value));
+  return value;
+}
+
+// Copies size words from in to out, reversing the bytes of each of them. The
+// loop is left to the auto-vectorizer, which turns it into byte shuffles.
+template <class Word>
+void byteswap_n(const std::byte* in,
+                std::size_t size,
+                std::byte* out) noexcept {
+  for (std::size_t i = 0; i < size; ++i) {
+    Word word;
+    std::memcpy(&word, in + i * sizeof(Word), sizeof(Word));
+    word = byteswap(word);
+    std::memcpy(out + i * sizeof(Word), &word, sizeof(Word));
+  }
+}
+
+template <class T, std::enable_if_t<is_wire_value<T>::value, int> = 0>
+T* raw_values(T* values) noexcept {
+  return values;
+}
+template <class T, std::enable_if_t<!is_wire_value<T>::value, int> = 0>
+auto* raw_values(T* values) noexcept {
+  return as_underlying(values);
+}
+
+template <endianness Endianness, class T>
+void encode(const T* values,
+            std::size_t size,
+            std::byte* out,
+            std::true_type /* contiguous */) noexcept {
+  using value_type = wire_value_t<T>;
+  const auto* in = reinterpret_cast<const std::byte*>(raw_values(values));
+  if (Endianness == endianness::native || sizeof(value_type) == 1) {
+    std::memcpy(out, in, size * sizeof(value_type));
+  } else {
+    byteswap_n<word_t<value_type>>(in, size, out);
+  }
+}
+
+template <endianness Endianness, class T>
+void encode(const T* values,
+            std::size_t size,
+            std::byte* out,
+            std::false_type /* contiguous */) noexcept {
+  using value_type = wire_value_t<T>;
+  for (std::size_t i = 0; i < size; ++i) {
+    store<Endianness, value_type>(out + i * sizeof(value_type),
+                                  get_value_t{}(values[i]));
+  }
+}
+
+template <endianness Endianness, class T>
+void decode(const std::byte* in,
+            T* values,
+            std::size_t size,
+            std::true_type /* contiguous */) noexcept {
+  using value_type = wire_value_t<T>;
+  auto* out = reinterpret_cast<std::byte*>(raw_values(values));
+  if (Endianness == endianness::native || sizeof(value_type) == 1) {
+    std::memcpy(out, in, size * sizeof(value_type));
+  } else {
+    byteswap_n<word_t<value_type>>(in, size, out);
+  }
+}
+
+template <endianness Endianness, class T>
+void decode(const std::byte* in,
+            T* values,
+            std::size_t size,
+            std::false_type /* contiguous */) noexcept {
+  using value_type = wire_value_t<T>;
+  for (std::size_t i = 0; i < size; ++i) {
+    get_value_t{}(values[i]) =
+        load<Endianness, value_type>(in + i * sizeof(value_type));
+  }
+}
+
+}  // namespace binary
+}  // namespace detail
+
+/// Number of bytes written for a T: the size of its value.
+template <class T>
+constexpr std::size_t serialized_size =
+    sizeof(detail::binary::wire_value_t<T>);
+
+/// Writes the value of a number, an enum, or a strong type holding one of
+/// them, to out in the given byte order. Returns the end of the bytes written.
+template <endianness Endianness,
+          class T,
+          class V = detail::binary::wire_value_t<T>>
+std::byte* write(std::byte* out, const T& value) noexcept {
+  detail::binary::store<Endianness, V>(out, get_value_t{}(value));
+  return out + sizeof(V);
+}
+
+/// Writes a serializable strong type in its byte order.
+template <class T,
+          endianness Endianness = detail::binary::endianness_of<T>::value>
+std::byte* write(std::byte* out, const T& value) noexcept {
+  return write<Endianness>(out, value);
+}
+
+/// Reads a value written by write in the given byte order. Returns the end of
+/// the bytes read.
+template <endianness Endianness,
+          class T,
+          class V = detail::binary::wire_value_t<T>>
+const std::byte* read(const std::byte* in, T& value) noexcept {
+  get_value_t{}(value) = detail::binary::load<Endianness, V>(in);
+  return in + sizeof(V);
+}
+
+/// Reads a serializable strong type in its byte order.
+template <class T,
+          endianness Endianness = detail::binary::endianness_of<T>::value>
+const std::byte* read(const std::byte* in, T& value) noexcept {
+  return read<Endianness>(in, value);
+}
+
+/// Writes size values one after the other, like write, and returns the end
+/// of the bytes written. Arrays of numbers or of strong types layout
+/// compatible with their values are copied with memcpy when the byte order is
+/// the one of the host, and swapped in a single loop otherwise.
+template <endianness Endianness,
+          class T,
+          class V = detail::binary::wire_value_t<T>>
+std::byte* encode(const T* values, std::size_t size, std::byte* out) noexcept {
+  detail::binary::encode<Endianness>(values, size, out,
+                                     detail::binary::is_contiguous<T>{});
+  return out + size * sizeof(V);
+}
+
+template <class T,
+          endianness Endianness = detail::binary::endianness_of<T>::value>
+std::byte* encode(const T* values, std::size_t size, std::byte* out) noexcept {
+  return encode<Endianness>(values, size, out);
+}
+
+/// Reads size values written by encode, and returns the end of the bytes
+/// read.
+template <endianness Endianness,
+          class T,
+          class V = detail::binary::wire_value_t<T>>
+const std::byte* decode(const std::byte* in,
+                        T* values,
+                        std::size_t size) noexcept {
+  detail::binary::decode<Endianness>(in, values, size,
+                                     detail::binary::is_contiguous<T>{});
+  return in + size * sizeof(V);
+}
+
+template <class T,
+          endianness Endianness = detail::binary::endianness_of<T>::value>
+const std::byte* decode(const std::byte* in,
+                        T* values,
+                        std::size_t size) noexcept {
+  return decode<Endianness>(in, values, size);
+}
+
+#ifdef __cpp_lib_span
+/// Encodes the values at the beginning of out, which must be large enough,
+/// and returns the rest of out.
+template <endianness Endianness, class T, std::size_t Extent>
+std::span<std::byte> encode(std::span<T, Extent> values,
+                            std::span<std::byte> out) noexcept {
+  assert(out.size() >= values.size() * serialized_size<std::remove_const_t<T>>);
+  const std::byte* last = encode<Endianness>(values.data(), values.size(),
+                                             out.data());
+  return out.subspan(static_cast<std::size_t>(last - out.data()));
+}
+
+template <class T,
+          std::size_t Extent,
+          endianness Endianness =
+              detail::binary::endianness_of<std::remove_const_t<T>>::value>
+std::span<std::byte> encode(std::span<T, Extent> values,
+                            std::span<std::byte> out) noexcept {
+  return encode<Endianness>(values, out);
+}
+
+/// Fills values from the beginning of in, which must be large enough, and
+/// returns the rest of in.
+template <endianness Endianness, class T, std::size_t Extent>
+std::span<const std::byte> decode(std::span<const std::byte> in,
+                                  std::span<T, Extent> values) noexcept {
+  assert(in.size() >= values.size() * serialized_size<T>);
+  const std::byte* last = decode<Endianness>(in.data(), values.data(),
+                                             values.size());
+  return in.subspan(static_cast<std::size_t>(last - in.data()));
+}
+
+template <class T,
+          std::size_t Extent,
+          endianness Endianness = detail::binary::endianness_of<T>::value>
+std::span<const std::byte> decode(std::span<const std::byte> in,
+                                  std::span<T, Extent> values) noexcept {
+  return decode<Endianness>(in, values);
+}
+#endif
+
+}  // namespace strong_types
+}  // namespace dpsg
+
+#endif  // __cpp_lib_byte
+
+#endif  // GUARD_DPSG_STRONG_TYPES_BINARY_HPP
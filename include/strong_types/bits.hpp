@@ -0,0 +1,93 @@
+#ifndef GUARD_DPSG_STRONG_TYPES_BITS_HPP
+#define GUARD_DPSG_STRONG_TYPES_BITS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#if __has_include(<bit>) && __cplusplus > 201703L
+#include <bit>
+#endif
+
+namespace dpsg {
+namespace strong_types {
+namespace detail {
+
+// The word must not be 0
+#if defined(__cpp_lib_bitops)
+constexpr int count_trailing_zeros(std::uint64_t word) noexcept {
+  return std::countr_zero(word);
+}
+constexpr std::size_t popcount(std::uint64_t word) noexcept {
+  return static_cast<std::size_t>(std::popcount(word));
+}
+#elif defined(__GNUC__) || defined(__clang__)
+constexpr int count_trailing_zeros(std::uint64_t word) noexcept {
+  return __builtin_ctzll(word);
+}
+constexpr std::size_t popcount(std::uint64_t word) noexcept {
+  return static_cast<std::size_t>(__builtin_popcountll(word));
+}
+#else
+constexpr int count_trailing_zeros(std::uint64_t word) noexcept {
+  int result = 0;
+  while ((word & 1) == 0) {
+    word >>= 1;
+    ++result;
+  }
+  return result;
+}
+constexpr std::size_t popcount(std::uint64_t word) noexcept {
+  std::size_t result = 0;
+  for (; word != 0; word &= word - 1) {
+    ++result;
+  }
+  return result;
+}
+#endif
+
+// Reverses the order of the bytes of the word
+constexpr std::uint8_t byteswap(std::uint8_t word) noexcept {
+  return word;
+}
+#if defined(__cpp_lib_byteswap)
+constexpr std::uint16_t byteswap(std::uint16_t word) noexcept {
+  return std::byteswap(word);
+}
+constexpr std::uint32_t byteswap(std::uint32_t word) noexcept {
+  return std::byteswap(word);
+}
+constexpr std::uint64_t byteswap(std::uint64_t word) noexcept {
+  return std::byteswap(word);
+}
+#elif defined(__GNUC__) || defined(__clang__)
+constexpr std::uint16_t byteswap(std::uint16_t word) noexcept {
+  return __builtin_bswap16(word);
+}
+constexpr std::uint32_t byteswap(std::uint32_t word) noexcept {
+  return __builtin_bswap32(word);
+}
+constexpr std::uint64_t byteswap(std::uint64_t word) noexcept {
+  return __builtin_bswap64(word);
+}
+#else
+// Recognized as a byte swap by MSVC and the other optimizers
+constexpr std::uint16_t byteswap(std::uint16_t word) noexcept {
+  return static_cast<std::uint16_t>((word << 8) | (word >> 8));
+}
+constexpr std::uint32_t byteswap(std::uint32_t word) noexcept {
+  return ((word & 0x000000FFu) << 24) | ((word & 0x0000FF00u) << 8) |
+         ((word & 0x00FF0000u) >> 8) | ((word & 0xFF000000u) >> 24);
+}
+constexpr std::uint64_t byteswap(std::uint64_t word) noexcept {
+  return (static_cast<std::uint64_t>(
+              byteswap(static_cast<std::uint32_t>(word)))
+          << 32) |
+         byteswap(static_cast<std::uint32_t>(word >> 32));
+}
+#endif
+
+}  // namespace detail
+}  // namespace strong_types
+}  // namespace dpsg
+
+#endif  // GUARD_DPSG_STRONG_TYPES_BITS_HPP
@@ -0,0 +1,614 @@
+#ifndef GUARD_DPSG_STRONG_TYPES_BULK_HPP
+#define GUARD_DPSG_STRONG_TYPES_BULK_HPP
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include <strong_types.hpp>
+#include <strong_types/layout.hpp>
+
+#if __cplusplus >= 201703L && __has_include(<experimental/simd>)
+#include <experimental/simd>
+#define DPSG_STRONG_TYPES_BULK_SIMD
+#endif
+
+namespace dpsg {
+namespace strong_types {
+
+namespace detail {
+namespace bulk {
+
+// Arrays of strong types are processed as arrays of their values when the
+// values are of one of these types, and when the strong operation is known to
+// compute exactly the same thing as the operation on the values. Every other
+// case falls back to a loop over the strong types themselves.
+template <class T, class = void>
+struct is_vectorizable : std::false_type {};
+template <class T>
+struct is_vectorizable<T, std::enable_if_t<std::is_arithmetic<T>::value>>
+    : std::integral_constant<bool,
+                             !std::is_same<T, bool>::value &&
+                                 sizeof(T) >= sizeof(int) && sizeof(T) <= 8> {
+};
+
+template <class T, class = void>
+struct underlying {
+  using type = void;
+};
+template <class T>
+struct underlying<T, std::enable_if_t<std::is_arithmetic<T>::value>> {
+  using type = T;
+};
+template <class T>
+struct underlying<
+    T,
+    std::enable_if_t<has_value<T>::value &&
+                     is_layout_compatible_with_value<T>::value &&
+                     std::is_trivially_copyable<T>::value>> {
+  using type = value_of_t<T>;
+};
+template <class T>
+using underlying_t = typename underlying<T>::type;
+
+template <class T,
+          std::enable_if_t<std::is_arithmetic<std::remove_const_t<T>>::value,
+                           int> = 0>
+T* raw(T* first) noexcept {
+  return first;
+}
+template <class T,
+          std::enable_if_t<!std::is_arithmetic<std::remove_const_t<T>>::value,
+                           int> = 0>
+auto* raw(T* first) noexcept {
+  return as_underlying(first);
+}
+
+template <class T, class V>
+constexpr T make(V v) noexcept {
+  return T{v};
+}
+
+// The type built by a strong operation whose result only wraps the result of
+// the same operation on the values (void for any other operation).
+template <class Operation, class L, class R>
+struct plain_operation {
+  using type = void;
+};
+template <class L, class R, class X>
+struct plain_operation<binary_operation<L, R, construct_t<X>, get_value_t, get_value_t>,
+                       L,
+                       R> {
+  using type = X;
+};
+template <class L, class R, class V, class X>
+struct plain_operation<
+    binary_operation<L, R, cast_to_then_construct_t<V, X>, get_value_t, get_value_t>,
+    L,
+    R> {
+  using type = X;
+};
+
+template <class Op, class L, class R, class = void>
+struct plain_result {
+  using type = void;
+};
+template <class Op, class L, class R>
+struct plain_result<Op, L, R, void_t<binary_operation_t<Op, const L&, const R&>>>
+    : plain_operation<binary_operation_t<Op, const L&, const R&>, L, R> {};
+template <class Op, class L, class R>
+struct plain_result<Op,
+                    L,
+                    R,
+                    std::enable_if_t<std::is_arithmetic<L>::value &&
+                                     std::is_same<L, R>::value>> {
+  using type = L;
+};
+
+template <class Op, class L, class R>
+using plain_result_t = typename plain_result<Op, L, R>::type;
+
+// Op between L and R produces Out through the same operation on values of a
+// common vectorizable type
+template <class Op, class L, class R, class Out>
+struct is_plain
+    : std::integral_constant<
+          bool,
+          std::is_same<plain_result_t<Op, L, R>, Out>::value &&
+              is_vectorizable<underlying_t<Out>>::value &&
+              std::is_same<underlying_t<L>, underlying_t<Out>>::value &&
+              std::is_same<underlying_t<R>, underlying_t<Out>>::value> {};
+
+template <class T, class = void>
+struct is_plain_comparison : std::is_arithmetic<T> {};
+template <class T>
+struct is_plain_comparison<
+    T,
+    void_t<binary_operation_t<lesser, const T&, const T&>>>
+    : std::is_same<binary_operation_t<lesser, const T&, const T&>,
+                   binary_operation<T,
+                                    T,
+                                    construct_t<bool>,
+                                    get_value_t,
+                                    get_value_t>> {};
+
+template <class T>
+struct is_plain_ordering
+    : std::integral_constant<bool,
+                             is_plain_comparison<T>::value &&
+                                 is_vectorizable<underlying_t<T>>::value> {};
+
+// The left operand is kept when the comparison is unordered (a NaN), in the
+// vector loop as in the scalar one. std::experimental::min and max follow the
+// rules of the instructions of the target instead.
+struct minimum {
+  template <class T>
+  constexpr T operator()(const T& left, const T& right) const noexcept {
+    return right < left ? right : left;
+  }
+#ifdef DPSG_STRONG_TYPES_BULK_SIMD
+  template <class T, class Abi>
+  std::experimental::simd<T, Abi> operator()(
+      const std::experimental::simd<T, Abi>& left,
+      const std::experimental::simd<T, Abi>& right) const noexcept {
+    std::experimental::simd<T, Abi> result = left;
+    std::experimental::where(right < left, result) = right;
+    return result;
+  }
+#endif
+};
+
+struct maximum {
+  template <class T>
+  constexpr T operator()(const T& left, const T& right) const noexcept {
+    return left < right ? right : left;
+  }
+#ifdef DPSG_STRONG_TYPES_BULK_SIMD
+  template <class T, class Abi>
+  std::experimental::simd<T, Abi> operator()(
+      const std::experimental::simd<T, Abi>& left,
+      const std::experimental::simd<T, Abi>& right) const noexcept {
+    std::experimental::simd<T, Abi> result = left;
+    std::experimental::where(left < right, result) = right;
+    return result;
+  }
+#endif
+};
+
+// Rounds once on floating point values, like std::fma, when the target has
+// fused multiply-add instructions. Elsewhere std::fma is emulated in software,
+// which is much slower than the separate operations.
+#if defined(FP_FAST_FMA) || defined(__FMA__)
+constexpr bool fast_fma = true;
+#else
+constexpr bool fast_fma = false;
+#endif
+
+struct fused_multiply_add {
+  template <class T,
+            std::enable_if_t<fast_fma && std::is_floating_point<T>::value,
+                             int> = 0>
+  T operator()(T a, T b, T c) const noexcept {
+    return std::fma(a, b, c);
+  }
+  template <class T,
+            std::enable_if_t<!(fast_fma && std::is_floating_point<T>::value),
+                             int> = 0>
+  constexpr T operator()(T a, T b, T c) const noexcept {
+    return a * b + c;
+  }
+#ifdef DPSG_STRONG_TYPES_BULK_SIMD
+  template <class T, class Abi>
+  std::experimental::simd<T, Abi> operator()(
+      const std::experimental::simd<T, Abi>& a,
+      const std::experimental::simd<T, Abi>& b,
+      const std::experimental::simd<T, Abi>& c) const noexcept {
+    if constexpr (fast_fma && std::is_floating_point<T>::value) {
+      return std::experimental::fma(a, b, c);
+    }
+    else {
+      return a * b + c;
+    }
+  }
+#endif
+};
+
+// Kernels on arrays of values. The loops over the remaining elements (or over
+// all of them without SIMD support) are left to the auto-vectorizer.
+#ifdef DPSG_STRONG_TYPES_BULK_SIMD
+namespace stdx = std::experimental;
+
+template <class T>
+using simd_t = stdx::native_simd<T>;
+
+template <class T>
+simd_t<T> load(const T* first) noexcept {
+  return simd_t<T>(first, stdx::element_aligned);
+}
+#endif
+
+template <class Op, class T>
+void transform_values(const T* left,
+                      const T* right,
+                      T* out,
+                      std::size_t size) {
+  std::size_t i = 0;
+#ifdef DPSG_STRONG_TYPES_BULK_SIMD
+  constexpr std::size_t width = simd_t<T>::size();
+  for (; i + width <= size; i += width) {
+    simd_t<T> result = Op{}(load(left + i), load(right + i));
+    result.copy_to(out + i, stdx::element_aligned);
+  }
+#endif
+  for (; i < size; ++i) {
+    out[i] = Op{}(left[i], right[i]);
+  }
+}
+
+template <class T>
+void scale_values(const T* values, T factor, T* out, std::size_t size) {
+  std::size_t i = 0;
+#ifdef DPSG_STRONG_TYPES_BULK_SIMD
+  constexpr std::size_t width = simd_t<T>::size();
+  const simd_t<T> factors(factor);
+  for (; i + width <= size; i += width) {
+    simd_t<T> result = load(values + i) * factors;
+    result.copy_to(out + i, stdx::element_aligned);
+  }
+#endif
+  for (; i < size; ++i) {
+    out[i] = values[i] * factor;
+  }
+}
+
+template <class T>
+void fma_values(const T* a,
+                const T* b,
+                const T* c,
+                T* out,
+                std::size_t size) {
+  std::size_t i = 0;
+#ifdef DPSG_STRONG_TYPES_BULK_SIMD
+  constexpr std::size_t width = simd_t<T>::size();
+  for (; i + width <= size; i += width) {
+    simd_t<T> result =
+        fused_multiply_add{}(load(a + i), load(b + i), load(c + i));
+    result.copy_to(out + i, stdx::element_aligned);
+  }
+#endif
+  for (; i < size; ++i) {
+    out[i] = fused_multiply_add{}(a[i], b[i], c[i]);
+  }
+}
+
+// Reductions accumulate in several lanes, which reorders the additions of
+// floating point values compared to a sequential loop.
+template <class T>
+T sum_values(const T* values, std::size_t size) {
+  T total{};
+  std::size_t i = 0;
+#ifdef DPSG_STRONG_TYPES_BULK_SIMD
+  constexpr std::size_t width = simd_t<T>::size();
+  simd_t<T> totals{};
+  for (; i + width <= size; i += width) {
+    totals += load(values + i);
+  }
+  total = stdx::reduce(totals);
+#endif
+  for (; i < size; ++i) {
+    total += values[i];
+  }
+  return total;
+}
+
+template <class T>
+T dot_values(const T* left, const T* right, std::size_t size) {
+  T total{};
+  std::size_t i = 0;
+#ifdef DPSG_STRONG_TYPES_BULK_SIMD
+  constexpr std::size_t width = simd_t<T>::size();
+  simd_t<T> totals{};
+  for (; i + width <= size; i += width) {
+    totals += load(left + i) * load(right + i);
+  }
+  total = stdx::reduce(totals);
+#endif
+  for (; i < size; ++i) {
+    total += left[i] * right[i];
+  }
+  return total;
+}
+
+template <class Op, class L, class R, class Out>
+void transform(const L* left,
+               const R* right,
+               Out* out,
+               std::size_t size,
+               std::true_type /* plain */) {
+  transform_values<Op>(raw(left), raw(right), raw(out), size);
+}
+
+template <class Op, class L, class R, class Out>
+void transform(const L* left,
+               const R* right,
+               Out* out,
+               std::size_t size,
+               std::false_type /* plain */) {
+  for (std::size_t i = 0; i < size; ++i) {
+    out[i] = Op{}(left[i], right[i]);
+  }
+}
+
+template <class Op, class L, class R, class Out>
+void transform(const L* left, const R* right, Out* out, std::size_t size) {
+  using result = std::decay_t<decltype(Op{}(*left, *right))>;
+  static_assert(std::is_assignable<Out&, result>::value,
+                "the result of the operation cannot be stored in the output");
+  transform<Op>(
+      left, right, out, size,
+      std::integral_constant<bool, is_plain<Op, L, R, Out>::value>{});
+}
+
+template <class Op, class T>
+void order(const T* left,
+           const T* right,
+           T* out,
+           std::size_t size,
+           std::true_type /* plain */) {
+  transform_values<Op>(raw(left), raw(right), raw(out), size);
+}
+
+template <class Op, class T>
+void order(const T* left,
+           const T* right,
+           T* out,
+           std::size_t size,
+           std::false_type /* plain */) {
+  for (std::size_t i = 0; i < size; ++i) {
+    out[i] = Op{}(left[i], right[i]);
+  }
+}
+
+template <class T, class F, class Out>
+void scale(const T* values,
+           const F& factor,
+           Out* out,
+           std::size_t size,
+           std::true_type /* plain */) {
+  scale_values(raw(values), factor, raw(out), size);
+}
+
+template <class T, class F, class Out>
+void scale(const T* values,
+           const F& factor,
+           Out* out,
+           std::size_t size,
+           std::false_type /* plain */) {
+  for (std::size_t i = 0; i < size; ++i) {
+    out[i] = values[i] * factor;
+  }
+}
+
+template <class A, class B, class C, class Out>
+void fma(const A* a,
+         const B* b,
+         const C* c,
+         Out* out,
+         std::size_t size,
+         std::true_type /* plain */) {
+  fma_values(raw(a), raw(b), raw(c), raw(out), size);
+}
+
+template <class A, class B, class C, class Out>
+void fma(const A* a,
+         const B* b,
+         const C* c,
+         Out* out,
+         std::size_t size,
+         std::false_type /* plain */) {
+  for (std::size_t i = 0; i < size; ++i) {
+    out[i] = a[i] * b[i] + c[i];
+  }
+}
+
+template <class Result, class T>
+Result sum(const T* values, std::size_t size, std::true_type /* plain */) {
+  return make<Result>(sum_values(raw(values), size));
+}
+
+template <class Result, class T>
+Result sum(const T* values, std::size_t size, std::false_type /* plain */) {
+  Result total{};
+  for (std::size_t i = 0; i < size; ++i) {
+    total = total + values[i];
+  }
+  return total;
+}
+
+template <class Result, class L, class R>
+Result dot(const L* left,
+           const R* right,
+           std::size_t size,
+           std::true_type /* plain */) {
+  return make<Result>(dot_values(raw(left), raw(right), size));
+}
+
+template <class Result, class L, class R>
+Result dot(const L* left,
+           const R* right,
+           std::size_t size,
+           std::false_type /* plain */) {
+  Result total{};
+  for (std::size_t i = 0; i < size; ++i) {
+    total = total + left[i] * right[i];
+  }
+  return total;
+}
+
+}  // namespace bulk
+}  // namespace detail
+
+/// out[i] = left[i] + right[i]
+template <class L, class R, class Out>
+void add(const L* left, const R* right, Out* out, std::size_t size) {
+  detail::bulk::transform<plus>(left, right, out, size);
+}
+
+/// out[i] = left[i] - right[i]
+template <class L, class R, class Out>
+void subtract(const L* left, const R* right, Out* out, std::size_t size) {
+  detail::bulk::transform<minus>(left, right, out, size);
+}
+
+/// out[i] = left[i] * right[i]
+template <class L, class R, class Out>
+void multiply(const L* left, const R* right, Out* out, std::size_t size) {
+  detail::bulk::transform<multiplies>(left, right, out, size);
+}
+
+/// out[i] = left[i] / right[i]
+template <class L, class R, class Out>
+void divide(const L* left, const R* right, Out* out, std::size_t size) {
+  detail::bulk::transform<divides>(left, right, out, size);
+}
+
+/// out[i] = values[i] * factor
+template <class T, class F, class Out>
+void scale(const T* values, const F& factor, Out* out, std::size_t size) {
+  using result = std::decay_t<decltype(*values * factor)>;
+  static_assert(std::is_assignable<Out&, result>::value,
+                "the result of the operation cannot be stored in the output");
+  using value_type = detail::bulk::underlying_t<Out>;
+  detail::bulk::scale(
+      values, factor, out, size,
+      std::integral_constant<
+          bool, detail::bulk::is_plain<multiplies, T, F, Out>::value &&
+                    std::is_same<F, value_type>::value>{});
+}
+
+/// out[i] = a[i] * b[i] + c[i]. With floating point values, the result is
+/// rounded once when the operations are those of the values and the target
+/// supports fused multiply-add (see std::fma).
+template <class A, class B, class C, class Out>
+void fma(const A* a, const B* b, const C* c, Out* out, std::size_t size) {
+  using product = std::decay_t<decltype(*a * *b)>;
+  using result = std::decay_t<decltype(std::declval<product>() + *c)>;
+  static_assert(std::is_assignable<Out&, result>::value,
+                "the result of the operation cannot be stored in the output");
+  detail::bulk::fma(
+      a, b, c, out, size,
+      std::integral_constant<
+          bool, detail::bulk::is_plain<multiplies, A, B, product>::value &&
+                    detail::bulk::is_plain<plus, product, C, Out>::value>{});
+}
+
+/// out[i] = the lesser of left[i] and right[i]
+template <class T>
+void min(const T* left, const T* right, T* out, std::size_t size) {
+  detail::bulk::order<detail::bulk::minimum>(
+      left, right, out, size,
+      std::integral_constant<bool,
+                             detail::bulk::is_plain_ordering<T>::value>{});
+}
+
+/// out[i] = the greater of left[i] and right[i]
+template <class T>
+void max(const T* left, const T* right, T* out, std::size_t size) {
+  detail::bulk::order<detail::bulk::maximum>(
+      left, right, out, size,
+      std::integral_constant<bool,
+                             detail::bulk::is_plain_ordering<T>::value>{});
+}
+
+/// Sum of the values (a value-initialized result if there are none)
+template <class T>
+auto sum(const T* values, std::size_t size) {
+  using result = std::decay_t<decltype(*values + *values)>;
+  return detail::bulk::sum<result>(
+      values, size,
+      std::integral_constant<bool,
+                             detail::bulk::is_plain<plus, T, T, result>::value>{});
+}
+
+/// Sum of the products left[i] * right[i]
+template <class L, class R>
+auto dot(const L* left, const R* right, std::size_t size) {
+  using result = std::decay_t<decltype(*left * *right)>;
+  return detail::bulk::dot<result>(
+      left, right, size,
+      std::integral_constant<
+          bool, detail::bulk::is_plain<multiplies, L, R, result>::value &&
+                    detail::bulk::is_plain<plus, result, result, result>::value>{});
+}
+
+#ifdef __cpp_lib_span
+#define DPSG_DEFINE_BULK_BINARY_SPAN_OPERATION(name)                   \
+  template <class L,                                                   \
+            std::size_t LeftExtent,                                    \
+            class R,                                                   \
+            std::size_t RightExtent,                                   \
+            class Out,                                                 \
+            std::size_t OutExtent>                                     \
+  void name(std::span<L, LeftExtent> left,                             \
+            std::span<R, RightExtent> right,                           \
+            std::span<Out, OutExtent> out) {                           \
+    assert(left.size() == out.size() && right.size() == out.size());   \
+    name(left.data(), right.data(), out.data(), out.size());           \
+  }
+
+DPSG_DEFINE_BULK_BINARY_SPAN_OPERATION(add)
+DPSG_DEFINE_BULK_BINARY_SPAN_OPERATION(subtract)
+DPSG_DEFINE_BULK_BINARY_SPAN_OPERATION(multiply)
+DPSG_DEFINE_BULK_BINARY_SPAN_OPERATION(divide)
+DPSG_DEFINE_BULK_BINARY_SPAN_OPERATION(min)
+DPSG_DEFINE_BULK_BINARY_SPAN_OPERATION(max)
+
+#undef DPSG_DEFINE_BULK_BINARY_SPAN_OPERATION
+
+template <class T,
+          std::size_t Extent,
+          class F,
+          class Out,
+          std::size_t OutExtent>
+void scale(std::span<T, Extent> values,
+           const F& factor,
+           std::span<Out, OutExtent> out) {
+  assert(values.size() == out.size());
+  scale(values.data(), factor, out.data(), out.size());
+}
+
+template <class A,
+          std::size_t AExtent,
+          class B,
+          std::size_t BExtent,
+          class C,
+          std::size_t CExtent,
+          class Out,
+          std::size_t OutExtent>
+void fma(std::span<A, AExtent> a,
+         std::span<B, BExtent> b,
+         std::span<C, CExtent> c,
+         std::span<Out, OutExtent> out) {
+  assert(a.size() == out.size() && b.size() == out.size() &&
+         c.size() == out.size());
+  fma(a.data(), b.data(), c.data(), out.data(), out.size());
+}
+
+template <class T, std::size_t Extent>
+auto sum(std::span<T, Extent> values) {
+  return sum(values.data(), values.size());
+}
+
+template <class L, std::size_t LeftExtent, class R, std::size_t RightExtent>
+auto dot(std::span<L, LeftExtent> left, std::span<R, RightExtent> right) {
+  assert(left.size() == right.size());
+  return dot(left.data(), right.data(), left.size());
+}
+#endif
+
+}  // namespace strong_types
+}  // namespace dpsg
+
+#endif  // GUARD_DPSG_STRONG_TYPES_BULK_HPP
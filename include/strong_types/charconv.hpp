@@ -0,0 +1,181 @@
+#ifndef GUARD_DPSG_STRONG_TYPES_CHARCONV_HPP
+#define GUARD_DPSG_STRONG_TYPES_CHARCONV_HPP
+
+#include <cstddef>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <strong_types.hpp>
+
+#if __cplusplus >= 201703L && __has_include(<charconv>)
+#include <charconv>
+#endif
+
+#if __has_include(<span>) && __cplusplus > 201703L
+#include <span>
+#endif
+
+#ifdef __cpp_lib_to_chars
+
+namespace dpsg {
+namespace strong_types {
+
+namespace detail {
+// Depends on the arguments of the functions, so that it is resolved when they
+// are called, once T is complete
+template <class As, class T, class... Args>
+struct charconv_as {
+  using type = As;
+};
+template <class T, class... Args>
+struct charconv_as<void, T, Args...> {
+  using type = value_of_t<T>;
+};
+template <class As, class T, class... Args>
+using charconv_as_t = typename charconv_as<As, T, Args...>::type;
+}  // namespace detail
+
+/// Provides to_chars and from_chars for the strong type, found by argument
+/// dependent lookup, with the arguments of std::to_chars and std::from_chars
+/// for its value (base, format, precision...). Values converted to As before
+/// formatting, and parsed as As, with charconv_formattable_as.
+template <class As = void>
+struct charconv_formattable_as {
+  template <class T>
+  struct type {
+    template <class... Args>
+    friend auto to_chars(char* first,
+                         char* last,
+                         const T& value,
+                         Args... args)
+        -> decltype(std::to_chars(
+            first,
+            last,
+            std::declval<detail::charconv_as_t<As, T, Args...>>(),
+            args...)) {
+      using as_t = detail::charconv_as_t<As, T, Args...>;
+      return std::to_chars(first, last,
+                           static_cast<as_t>(get_value_t{}(value)), args...);
+    }
+
+    /// On failure the strong value is left unmodified, like std::from_chars
+    template <class... Args>
+    friend auto from_chars(const char* first,
+                           const char* last,
+                           T& value,
+                           Args... args)
+        -> decltype(std::from_chars(
+            first,
+            last,
+            std::declval<detail::charconv_as_t<As, T, Args...>&>(),
+            args...)) {
+      detail::charconv_as_t<As, T, Args...> parsed{};
+      const auto result = std::from_chars(first, last, parsed, args...);
+      if (result.ec == std::errc{}) {
+        get_value_t{}(value) =
+            static_cast<detail::value_of_t<T>>(std::move(parsed));
+      }
+      return result;
+    }
+  };
+};
+
+struct charconv_formattable : charconv_formattable_as<> {};
+
+/// Result of from_chars_n: the number of values parsed, in addition to the
+/// position and error of std::from_chars_result.
+struct from_chars_n_result {
+  const char* ptr;
+  std::errc ec;
+  std::size_t count;
+};
+
+/// Writes the values one after the other, separated by separator, in
+/// [first, last). On success, the result points past the last character
+/// written. Otherwise its ec is std::errc::value_too_large and its ptr is
+/// last, like std::to_chars. The values can be numbers or strong types with a
+/// to_chars function (like the charconv_formattable ones).
+template <class T, class... Args>
+std::to_chars_result to_chars_n(char* first,
+                                char* last,
+                                const T* values,
+                                std::size_t size,
+                                char separator,
+                                Args... args) {
+  using std::to_chars;
+  for (std::size_t i = 0; i < size; ++i) {
+    if (i != 0) {
+      if (first == last) {
+        return {last, std::errc::value_too_large};
+      }
+      *first++ = separator;
+    }
+    const std::to_chars_result result =
+        to_chars(first, last, values[i], args...);
+    if (result.ec != std::errc{}) {
+      return result;
+    }
+    first = result.ptr;
+  }
+  return {first, std::errc{}};
+}
+
+/// Parses up to size values separated by separator from [first, last). The
+/// parsing stops after size values, at the end of the input, or at the first
+/// value that can't be parsed, whose error is returned. The values parsed
+/// before it are kept.
+template <class T, class... Args>
+from_chars_n_result from_chars_n(const char* first,
+                                 const char* last,
+                                 T* values,
+                                 std::size_t size,
+                                 char separator,
+                                 Args... args) {
+  using std::from_chars;
+  std::size_t count = 0;
+  while (count < size && first != last) {
+    if (count != 0) {
+      if (*first != separator) {
+        break;
+      }
+      ++first;
+    }
+    const auto result = from_chars(first, last, values[count], args...);
+    if (result.ec != std::errc{}) {
+      return {result.ptr, result.ec, count};
+    }
+    first = result.ptr;
+    ++count;
+  }
+  return {first, std::errc{}, count};
+}
+
+#ifdef __cpp_lib_span
+template <class T, std::size_t Extent, class... Args>
+std::to_chars_result to_chars_n(char* first,
+                                char* last,
+                                std::span<T, Extent> values,
+                                char separator,
+                                Args... args) {
+  return to_chars_n(first, last, values.data(), values.size(), separator,
+                    args...);
+}
+
+template <class T, std::size_t Extent, class... Args>
+from_chars_n_result from_chars_n(const char* first,
+                                 const char* last,
+                                 std::span<T, Extent> values,
+                                 char separator,
+                                 Args... args) {
+  return from_chars_n(first, last, values.data(), values.size(), separator,
+                      args...);
+}
+#endif
+
+}  // namespace strong_types
+}  // namespace dpsg
+
+#endif  // __cpp_lib_to_chars
+
+#endif  // GUARD_DPSG_STRONG_TYPES_CHARCONV_HPP
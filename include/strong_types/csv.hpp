@@ -0,0 +1,363 @@
+#ifndef GUARD_DPSG_STRONG_TYPES_CSV_HPP
+#define GUARD_DPSG_STRONG_TYPES_CSV_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <istream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <strong_types.hpp>
+#include <strong_types/bits.hpp>
+#include <strong_types/charconv.hpp>
+
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DPSG_STRONG_TYPES_CSV_SSE2
+#endif
+
+// <charconv> requires C++17
+#ifdef __cpp_lib_to_chars
+
+namespace dpsg {
+namespace strong_types {
+
+/// Thrown by csv_reader on lines that don't match its columns.
+class csv_error : public std::runtime_error {
+ public:
+  csv_error(std::size_t line, std::size_t column, const std::string& what)
+      : std::runtime_error("line " + std::to_string(line) + ", column " +
+                           std::to_string(column) + ": " + what),
+        line_{line},
+        column_{column} {}
+
+  /// Position of the error, starting at 1
+  std::size_t line() const noexcept { return line_; }
+  std::size_t column() const noexcept { return column_; }
+
+ private:
+  std::size_t line_;
+  std::size_t column_;
+};
+
+namespace detail {
+namespace csv {
+
+// Gives the positions of the delimiters and line feeds of [first, last) in
+// order, looking for them 16 bytes at a time
+class separator_scanner {
+ public:
+  static constexpr std::size_t block_size = 16;
+
+  separator_scanner(const char* first,
+                    const char* last,
+                    char delimiter) noexcept
+      : block_{first}, last_{last}, delimiter_{delimiter} {
+    mask_ = scan(block_);
+  }
+
+  /// The next separator, or last when there is none left
+  const char* next() noexcept {
+    while (mask_ == 0) {
+      block_ += block_size;
+      if (block_ >= last_) {
+        return last_;
+      }
+      mask_ = scan(block_);
+    }
+    const char* separator = block_ + count_trailing_zeros(mask_);
+    mask_ &= mask_ - 1;
+    return separator;
+  }
+
+ private:
+  std::uint32_t scan(const char* block) const noexcept {
+    if (block >= last_) {
+      return 0;
+    }
+#ifdef DPSG_STRONG_TYPES_CSV_SSE2
+    if (static_cast<std::size_t>(last_ - block) >= block_size) {
+      const __m128i bytes =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+      const __m128i separators =
+          _mm_or_si128(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(delimiter_)),
+                       _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\n')));
+      return static_cast<std::uint32_t>(_mm_movemask_epi8(separators));
+    }
+#endif
+    const auto remaining = static_cast<std::size_t>(last_ - block);
+    const std::size_t size = remaining < block_size ? remaining : block_size;
+    std::uint32_t mask = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+      if (block[i] == delimiter_ || block[i] == '\n') {
+        mask |= std::uint32_t{1} << i;
+      }
+    }
+    return mask;
+  }
+
+  const char* block_;
+  const char* last_;
+  std::uint32_t mask_;
+  char delimiter_;
+};
+
+// Fields are parsed by the first of these that applies: from_chars found by
+// argument dependent lookup (charconv_formattable and numbers), from_chars on
+// their value, or the constructor of their value from the characters.
+template <std::size_t N>
+struct rank : rank<N - 1> {};
+template <>
+struct rank<0> {};
+
+using std::from_chars;
+
+template <class T>
+auto parse(const char* first, const char* last, T& field, rank<2>)
+    -> decltype(from_chars(first, last, field), bool()) {
+  const auto result = from_chars(first, last, field);
+  return result.ec == std::errc{} && result.ptr == last;
+}
+
+template <class T>
+auto parse(const char* first, const char* last, T& field, rank<1>)
+    -> decltype(from_chars(first, last, get_value_t{}(field)), bool()) {
+  const auto result = from_chars(first, last, get_value_t{}(field));
+  return result.ec == std::errc{} && result.ptr == last;
+}
+
+template <class T,
+          std::enable_if_t<std::is_constructible<value_of_t<T>,
+                                                 const char*,
+                                                 std::size_t>::value,
+                           int> = 0>
+bool parse(const char* first, const char* last, T& field, rank<0>) {
+  get_value_t{}(field) =
+      value_of_t<T>(first, static_cast<std::size_t>(last - first));
+  return true;
+}
+
+}  // namespace csv
+}  // namespace detail
+
+/// Parses delimited text into one column per field: a line holds one value of
+/// each of the Fields, separated by a delimiter, and each value is appended
+/// to the std::vector of its column. The text is given in chunks of any size,
+/// lines being parsed as soon as they are complete, without allocating
+/// anything but the columns. Values are parsed with from_chars, found by
+/// argument dependent lookup (see charconv_formattable) or called on the
+/// value of the fields, or by constructing the value of the field from the
+/// characters (for strings). Fields can't be quoted, and empty lines are
+/// ignored.
+template <class... Fields>
+class csv_reader {
+ public:
+  static_assert(sizeof...(Fields) > 0, "csv_reader expects columns");
+  using columns_type = std::tuple<std::vector<Fields>...>;
+
+  explicit csv_reader(char delimiter = ',',
+                      std::size_t header_lines = 0) noexcept
+      : delimiter_{delimiter}, header_lines_{header_lines} {}
+
+  /// Parses the complete lines of the chunk. The end of the last line, when
+  /// incomplete, is kept for the next chunk. Throws csv_error on lines that
+  /// don't match the fields, after which the reader must not be used.
+  void feed(const char* first, const char* last) {
+    if (!pending_.empty()) {
+      const char* end_of_line = static_cast<const char*>(
+          std::memchr(first, '\n', static_cast<std::size_t>(last - first)));
+      if (end_of_line == nullptr) {
+        pending_.append(first, last);
+        return;
+      }
+      pending_.append(first, end_of_line + 1);
+      const char* pending_first = pending_.data();
+      parse_lines(pending_first, pending_first + pending_.size());
+      pending_.clear();
+      first = end_of_line + 1;
+    }
+    const char* rest = parse_lines(first, last);
+    if (rest != last && !skipping_header()) {
+      pending_.assign(rest, last);
+    }
+  }
+
+  void feed(const std::string& chunk) {
+    feed(chunk.data(), chunk.data() + chunk.size());
+  }
+
+  /// Parses the last line when the text doesn't end with a line feed.
+  void finish() {
+    if (!pending_.empty()) {
+      pending_.push_back('\n');
+      const char* first = pending_.data();
+      parse_lines(first, first + pending_.size());
+      pending_.clear();
+    }
+  }
+
+  /// Feeds the whole stream, chunk_size bytes at a time, and finishes.
+  void read(std::istream& stream, std::size_t chunk_size = 1 << 16) {
+    std::vector<char> chunk(chunk_size);
+    while (stream) {
+      stream.read(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+      const auto size = static_cast<std::size_t>(stream.gcount());
+      feed(chunk.data(), chunk.data() + size);
+    }
+    finish();
+  }
+
+  /// Reserves room for rows values in every column
+  void reserve(std::size_t rows) {
+    reserve(rows, std::index_sequence_for<Fields...>{});
+  }
+
+  template <std::size_t I>
+  auto& column() noexcept {
+    return std::get<I>(columns_);
+  }
+  template <std::size_t I>
+  const auto& column() const noexcept {
+    return std::get<I>(columns_);
+  }
+  /// The column of Field, which must appear once in Fields
+  template <class Field>
+  std::vector<Field>& column() noexcept {
+    return std::get<detail::position_of<Field, Fields...>::value>(columns_);
+  }
+  template <class Field>
+  const std::vector<Field>& column() const noexcept {
+    return std::get<detail::position_of<Field, Fields...>::value>(columns_);
+  }
+
+  columns_type& columns() noexcept { return columns_; }
+  const columns_type& columns() const noexcept { return columns_; }
+
+  /// Number of values in each column
+  std::size_t size() const noexcept { return std::get<0>(columns_).size(); }
+  /// Number of complete lines read, including the header and empty lines
+  std::size_t lines() const noexcept { return lines_; }
+
+ private:
+  bool skipping_header() const noexcept { return lines_ < header_lines_; }
+
+  // Returns the beginning of the incomplete line ending the text
+  const char* parse_lines(const char* first, const char* last) {
+    while (first != last && skipping_header()) {
+      const char* end_of_line = static_cast<const char*>(
+          std::memchr(first, '\n', static_cast<std::size_t>(last - first)));
+      if (end_of_line == nullptr) {
+        return last;
+      }
+      first = end_of_line + 1;
+      ++lines_;
+    }
+    detail::csv::separator_scanner scanner{first, last, delimiter_};
+    std::tuple<Fields...> row;
+    while (first != last) {
+      const char* end_of_line =
+          parse_line(first, last, scanner, row,
+                     std::index_sequence_for<Fields...>{});
+      if (end_of_line == last) {
+        return first;
+      }
+      first = end_of_line + 1;
+      ++lines_;
+    }
+    return last;
+  }
+
+  // Parses the fields in row, then appends them to the columns. Returns the
+  // line feed ending the line, or last if the line is incomplete.
+  template <std::size_t... Is>
+  const char* parse_line(const char* first,
+                         const char* last,
+                         detail::csv::separator_scanner& scanner,
+                         std::tuple<Fields...>& row,
+                         std::index_sequence<Is...>) {
+    const char* separator = scanner.next();
+    if (separator == last) {
+      return last;
+    }
+    if (*separator == '\n' && is_blank(first, separator)) {
+      return separator;
+    }
+    bool complete = true;
+    const bool parsed[] = {
+        (complete = complete &&
+                    parse_field<Is>(first, separator, last, scanner, row))...};
+    (void)parsed;
+    if (!complete) {
+      return last;
+    }
+    (void)std::initializer_list<int>{
+        (std::get<Is>(columns_).push_back(std::move(std::get<Is>(row))),
+         0)...};
+    return separator;
+  }
+
+  // Parses the field in [first, separator), and moves to the next field.
+  // Returns false when the line is incomplete.
+  template <std::size_t I>
+  bool parse_field(const char*& first,
+                   const char*& separator,
+                   const char* last,
+                   detail::csv::separator_scanner& scanner,
+                   std::tuple<Fields...>& row) {
+    if (I != 0) {
+      first = separator + 1;
+      separator = scanner.next();
+      if (separator == last) {
+        return false;
+      }
+    }
+    constexpr bool last_field = I + 1 == sizeof...(Fields);
+    if (!last_field && *separator == '\n') {
+      throw csv_error(lines_ + 1, I + 1, "missing columns");
+    }
+    if (last_field && *separator != '\n') {
+      throw csv_error(lines_ + 1, I + 2, "too many columns");
+    }
+    const char* end = separator;
+    if (last_field && end != first && end[-1] == '\r') {
+      --end;
+    }
+    if (!detail::csv::parse(first, end, std::get<I>(row),
+                            detail::csv::rank<2>{})) {
+      throw csv_error(lines_ + 1, I + 1,
+                      "invalid value \"" + std::string(first, end) + "\"");
+    }
+    return true;
+  }
+
+  static bool is_blank(const char* first, const char* end_of_line) noexcept {
+    return first == end_of_line || (first + 1 == end_of_line && *first == '\r');
+  }
+
+  template <std::size_t... Is>
+  void reserve(std::size_t rows, std::index_sequence<Is...>) {
+    (void)std::initializer_list<int>{
+        (std::get<Is>(columns_).reserve(rows), 0)...};
+  }
+
+  columns_type columns_;
+  std::string pending_;
+  std::size_t lines_{0};
+  char delimiter_;
+  std::size_t header_lines_;
+};
+
+}  // namespace strong_types
+}  // namespace dpsg
+
+#endif  // __cpp_lib_to_chars
+
+#endif  // GUARD_DPSG_STRONG_TYPES_CSV_HPP
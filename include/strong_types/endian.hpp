@@ -0,0 +1,283 @@
+#ifndef GUARD_DPSG_STRONG_TYPES_ENDIAN_HPP
+#define GUARD_DPSG_STRONG_TYPES_ENDIAN_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+
+#include <strong_types.hpp>
+#include <strong_types/binary.hpp>
+
+// std::byte requires C++17
+#ifdef __cpp_lib_byte
+
+namespace dpsg {
+namespace strong_types {
+
+/// Holds a Strong as the bytes of its value in the given byte order, as it is
+/// stored in a file or sent over the network. Its alignment is 1 and it has no
+/// padding, so that structures of endian_storage can be placed directly over
+/// a buffer of bytes. The value is only converted to the byte order of the
+/// host by the arithmetic and ordering operators, which return Strong.
+template <class Strong, endianness Endianness>
+class endian_storage {
+  using wire_type = detail::binary::wire_value_t<Strong>;
+
+ public:
+  using strong_type = Strong;
+  using value_type = detail::value_of_t<Strong>;
+  static constexpr endianness byte_order = Endianness;
+
+  static_assert(std::is_same<wire_type, value_type>::value,
+                "endian_storage holds strong types of numbers or enums");
+
+  endian_storage() noexcept = default;
+  explicit endian_storage(const Strong& value) noexcept { store(value); }
+
+  endian_storage& operator=(const Strong& value) noexcept {
+    store(value);
+    return *this;
+  }
+
+  /// The strong type, converted to the byte order of the host
+  Strong load() const noexcept {
+    return Strong{
+        detail::binary::load<Endianness, value_type>(bytes_)};
+  }
+  explicit operator Strong() const noexcept { return load(); }
+
+  void store(const Strong& value) noexcept {
+    detail::binary::store<Endianness, value_type>(bytes_,
+                                                  get_value_t{}(value));
+  }
+
+  /// The bytes of the value, in the byte order of the storage
+  const std::byte* data() const noexcept { return bytes_; }
+  std::byte* data() noexcept { return bytes_; }
+  static constexpr std::size_t size() noexcept { return sizeof(value_type); }
+
+#define DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(op)                               \
+  template <class U,                                                          \
+            class = decltype(std::declval<Strong&>()                          \
+                                 op std::declval<const U&>())>               \
+  endian_storage& operator op(const U& right) noexcept {                      \
+    Strong value = load();                                                    \
+    value op right;                                                           \
+    store(value);                                                             \
+    return *this;                                                             \
+  }                                                                           \
+  template <class S,                                                          \
+            endianness E,                                                     \
+            class = decltype(std::declval<Strong&>() op std::declval<S>())>   \
+  endian_storage& operator op(const endian_storage<S, E>& right) noexcept {   \
+    return *this op right.load();                                             \
+  }
+
+  DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(+=)
+  DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(-=)
+  DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(*=)
+  DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(/=)
+  DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(%=)
+  DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(&=)
+  DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(|=)
+  DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(^=)
+  DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(<<=)
+  DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(>>=)
+#undef DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT
+
+  template <class S = Strong, class = decltype(++std::declval<S&>())>
+  endian_storage& operator++() noexcept {
+    Strong value = load();
+    ++value;
+    store(value);
+    return *this;
+  }
+  template <class S = Strong, class = decltype(++std::declval<S&>())>
+  Strong operator++(int) noexcept {
+    const Strong value = load();
+    ++*this;
+    return value;
+  }
+  template <class S = Strong, class = decltype(--std::declval<S&>())>
+  endian_storage& operator--() noexcept {
+    Strong value = load();
+    --value;
+    store(value);
+    return *this;
+  }
+  template <class S = Strong, class = decltype(--std::declval<S&>())>
+  Strong operator--(int) noexcept {
+    const Strong value = load();
+    --*this;
+    return value;
+  }
+
+ private:
+  std::byte bytes_[sizeof(value_type)];
+};
+
+template <class Strong>
+using big_endian = endian_storage<Strong, endianness::big>;
+template <class Strong>
+using little_endian = endian_storage<Strong, endianness::little>;
+
+namespace detail {
+template <class T>
+struct is_endian_storage : std::false_type {};
+template <class Strong, endianness Endianness>
+struct is_endian_storage<endian_storage<Strong, Endianness>> : std::true_type {
+};
+
+template <class L, class R>
+using enable_if_endian_operands_t =
+    std::enable_if_t<is_endian_storage<L>::value ||
+                     is_endian_storage<R>::value>;
+
+template <class T, std::enable_if_t<!is_endian_storage<T>::value, int> = 0>
+constexpr const T& loaded(const T& value) noexcept {
+  return value;
+}
+template <class Strong, endianness Endianness>
+Strong loaded(const endian_storage<Strong, Endianness>& value) noexcept {
+  return value.load();
+}
+
+// Equal values have equal bytes when they are integers or enums, so they are
+// compared as they are stored
+template <class Strong>
+struct is_bitwise_comparable
+    : std::integral_constant<bool,
+                             std::is_integral<value_of_t<Strong>>::value ||
+                                 std::is_enum<value_of_t<Strong>>::value> {};
+
+template <class Strong, endianness Endianness>
+bool equal(const endian_storage<Strong, Endianness>& left,
+           const endian_storage<Strong, Endianness>& right,
+           std::true_type /* bitwise */) noexcept {
+  return std::memcmp(left.data(), right.data(), left.size()) == 0;
+}
+template <class Strong, endianness Endianness>
+bool equal(const endian_storage<Strong, Endianness>& left,
+           const Strong& right,
+           std::true_type /* bitwise */) noexcept {
+  return equal(left, endian_storage<Strong, Endianness>{right},
+               std::true_type{});
+}
+template <class Strong, endianness Endianness>
+bool equal(const Strong& left,
+           const endian_storage<Strong, Endianness>& right,
+           std::true_type /* bitwise */) noexcept {
+  return equal(endian_storage<Strong, Endianness>{left}, right,
+               std::true_type{});
+}
+template <class L, class R>
+bool equal(const L& left, const R& right, std::false_type /* bitwise */) {
+  return loaded(left) == loaded(right);
+}
+
+// The same strong type and byte order on both sides
+template <class L, class R>
+struct same_storage : std::false_type {};
+template <class Strong, endianness Endianness>
+struct same_storage<endian_storage<Strong, Endianness>,
+                    endian_storage<Strong, Endianness>>
+    : is_bitwise_comparable<Strong> {};
+template <class Strong, endianness Endianness>
+struct same_storage<endian_storage<Strong, Endianness>, Strong>
+    : is_bitwise_comparable<Strong> {};
+template <class Strong, endianness Endianness>
+struct same_storage<Strong, endian_storage<Strong, Endianness>>
+    : is_bitwise_comparable<Strong> {};
+}  // namespace detail
+
+// The operators of Strong, applied after converting the storages to the byte
+// order of the host. Only == and != compare the stored bytes directly.
+#define DPSG_STRONG_TYPES_ENDIAN_OPERATOR(op)                         \
+  template <class L, class R,                                         \
+            class = detail::enable_if_endian_operands_t<L, R>>        \
+  auto operator op(const L& left, const R& right) noexcept(           \
+      noexcept(detail::loaded(left) op detail::loaded(right)))        \
+      ->decltype(detail::loaded(left) op detail::loaded(right)) {     \
+    return detail::loaded(left) op detail::loaded(right);             \
+  }
+
+DPSG_STRONG_TYPES_ENDIAN_OPERATOR(+)
+DPSG_STRONG_TYPES_ENDIAN_OPERATOR(-)
+DPSG_STRONG_TYPES_ENDIAN_OPERATOR(*)
+DPSG_STRONG_TYPES_ENDIAN_OPERATOR(/)
+DPSG_STRONG_TYPES_ENDIAN_OPERATOR(%)
+DPSG_STRONG_TYPES_ENDIAN_OPERATOR(&)
+DPSG_STRONG_TYPES_ENDIAN_OPERATOR(|)
+DPSG_STRONG_TYPES_ENDIAN_OPERATOR(^)
+DPSG_STRONG_TYPES_ENDIAN_OPERATOR(<<)
+DPSG_STRONG_TYPES_ENDIAN_OPERATOR(>>)
+DPSG_STRONG_TYPES_ENDIAN_OPERATOR(<)
+DPSG_STRONG_TYPES_ENDIAN_OPERATOR(>)
+DPSG_STRONG_TYPES_ENDIAN_OPERATOR(<=)
+DPSG_STRONG_TYPES_ENDIAN_OPERATOR(>=)
+#undef DPSG_STRONG_TYPES_ENDIAN_OPERATOR
+
+// Storages on the left of compound assignments are handled by their members
+#define DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(op)                              \
+  template <class L,                                                         \
+            class Strong,                                                    \
+            endianness Endianness,                                           \
+            std::enable_if_t<!detail::is_endian_storage<L>::value, int> = 0, \
+            class = decltype(std::declval<L&>() op std::declval<Strong>())>  \
+  L& operator op(L& left,                                                    \
+                 const endian_storage<Strong, Endianness>& right) {          \
+    left op right.load();                                                    \
+    return left;                                                             \
+  }
+
+DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(+=)
+DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(-=)
+DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(*=)
+DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(/=)
+DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(%=)
+DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(&=)
+DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(|=)
+DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(^=)
+DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(<<=)
+DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT(>>=)
+#undef DPSG_STRONG_TYPES_ENDIAN_ASSIGNMENT
+
+template <class L,
+          class R,
+          class = detail::enable_if_endian_operands_t<L, R>,
+          class = decltype(detail::loaded(std::declval<const L&>()) ==
+                           detail::loaded(std::declval<const R&>()))>
+bool operator==(const L& left, const R& right) {
+  return detail::equal(left, right, detail::same_storage<L, R>{});
+}
+
+template <class L,
+          class R,
+          class = detail::enable_if_endian_operands_t<L, R>,
+          class = decltype(detail::loaded(std::declval<const L&>()) ==
+                           detail::loaded(std::declval<const R&>()))>
+bool operator!=(const L& left, const R& right) {
+  return !(left == right);
+}
+
+template <class Strong,
+          endianness Endianness,
+          class = decltype(-std::declval<const Strong&>())>
+auto operator-(const endian_storage<Strong, Endianness>& value) {
+  return -value.load();
+}
+
+template <class Strong,
+          endianness Endianness,
+          class = decltype(~std::declval<const Strong&>())>
+auto operator~(const endian_storage<Strong, Endianness>& value) {
+  return ~value.load();
+}
+
+}  // namespace strong_types
+}  // namespace dpsg
+
+#endif  // __cpp_lib_byte
+
+#endif  // GUARD_DPSG_STRONG_TYPES_ENDIAN_HPP
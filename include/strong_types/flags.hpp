@@ -1,7 +1,14 @@
 #ifndef GUARD_DPSG_STRONG_TYPES_FLAGS_HPP
 #define GUARD_DPSG_STRONG_TYPES_FLAGS_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
 #include <strong_types.hpp>
+#include <strong_types/bits.hpp>
 
 namespace dpsg {
 namespace strong_types {
@@ -23,11 +30,39 @@ struct return_left_argument {
   }
 };
 
+/// Reference to an enumeration value through which self assigning operators
+/// compute on its underlying Type, then store the result back in the
+/// enumeration. The storage of the enumeration is never accessed as Type.
+template <class Enum, class Type>
+class underlying_value_ref {
+ public:
+  constexpr explicit underlying_value_ref(Enum& value) noexcept
+      : value_{value} {}
+
+#define DPSG_STRONG_TYPES_UNDERLYING_ASSIGNMENT(sym, op)                \
+  template <class U>                                                    \
+  constexpr underlying_value_ref& operator sym(U&& right) noexcept {    \
+    value_ =                                                            \
+        static_cast<Enum>(static_cast<Type>(value_) op std::forward<U>( \
+            right));                                                    \
+    return *this;                                                       \
+  }
+  DPSG_STRONG_TYPES_UNDERLYING_ASSIGNMENT(&=, &)
+  DPSG_STRONG_TYPES_UNDERLYING_ASSIGNMENT(|=, |)
+  DPSG_STRONG_TYPES_UNDERLYING_ASSIGNMENT(^=, ^)
+  DPSG_STRONG_TYPES_UNDERLYING_ASSIGNMENT(<<=, <<)
+  DPSG_STRONG_TYPES_UNDERLYING_ASSIGNMENT(>>=, >>)
+#undef DPSG_STRONG_TYPES_UNDERLYING_ASSIGNMENT
+
+ private:
+  Enum& value_;
+};
+
 template <class Type>
 struct access_value_as_ref {
   template <class T>
-  constexpr auto& operator()(T& t) const noexcept {
-    return *reinterpret_cast<Type*>(&t.value);
+  constexpr auto operator()(T& t) const noexcept {
+    return underlying_value_ref<decltype(t.value), Type>{t.value};
   }
 };
 
@@ -83,7 +118,8 @@ using flag_derivation = derive_t<Self,
                                  Args...>;
 
 template <class Type, class Tag, class... Args>
-struct flag : flag_derivation<flag<Type, Tag, Args...>, Type, Args...> {
+struct DPSG_STRONG_TYPES_EMPTY_BASES flag
+    : flag_derivation<flag<Type, Tag, Args...>, Type, Args...> {
  public:
   static_assert(std::is_enum<Type>::value,
                 "Underlying type for flag must be an enum");
@@ -101,6 +137,209 @@ struct flag : flag_derivation<flag<Type, Tag, Args...>, Type, Args...> {
   constexpr flag() noexcept = default;
 };
 
+namespace detail {
+template <class T, class = void>
+struct is_flag_like : std::is_enum<T> {};
+template <class T>
+struct is_flag_like<T, std::enable_if_t<std::is_enum<value_of_t<T>>::value>>
+    : std::true_type {};
+
+template <class T, class = void>
+struct flag_enum {
+  using type = T;
+};
+template <class T>
+struct flag_enum<T, std::enable_if_t<std::is_enum<value_of_t<T>>::value>> {
+  using type = value_of_t<T>;
+};
+template <class T>
+using flag_enum_t = typename flag_enum<T>::type;
+
+template <class T>
+using enable_if_flag_t = std::enable_if_t<is_flag_like<T>::value, int>;
+
+template <class Enum>
+using unsigned_underlying_t = std::make_unsigned_t<std::underlying_type_t<Enum>>;
+
+template <class Enum, std::enable_if_t<std::is_enum<Enum>::value, int> = 0>
+constexpr std::uint64_t flag_bits(Enum e) noexcept {
+  return static_cast<unsigned_underlying_t<Enum>>(e);
+}
+template <class T, std::enable_if_t<!std::is_enum<T>::value, int> = 0>
+constexpr std::uint64_t flag_bits(const T& t) noexcept {
+  return flag_bits(get_value_t{}(t));
+}
+
+template <class Enum>
+constexpr Enum flag_from_bits(std::uint64_t bits) noexcept {
+  return static_cast<Enum>(static_cast<unsigned_underlying_t<Enum>>(bits));
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+#define DPSG_STRONG_TYPES_ENUMERATOR_PROBE
+// The signature ends with "V = e::a]" when V is an enumerator of E, and with
+// a cast like "V = (e)8]" otherwise.
+template <class E, E V>
+constexpr bool is_enumerator() noexcept {
+  const char* signature = __PRETTY_FUNCTION__;
+  std::size_t i = sizeof(__PRETTY_FUNCTION__) - 1;
+  while (i > 0 && signature[i] != ']') {
+    --i;
+  }
+  do {
+    --i;
+  } while (i > 0 && ((signature[i] >= '0' && signature[i] <= '9') ||
+                     signature[i] == '-'));
+  return signature[i] != ')';
+}
+
+template <class Enum, std::size_t... Is>
+constexpr std::uint64_t declared_bits(std::index_sequence<Is...>) noexcept {
+  const bool declared[] = {
+      is_enumerator<Enum, flag_from_bits<Enum>(std::uint64_t{1} << Is)>()...};
+  std::uint64_t result = 0;
+  for (std::size_t i = 0; i < sizeof...(Is); ++i) {
+    if (declared[i]) {
+      result |= std::uint64_t{1} << i;
+    }
+  }
+  return result;
+}
+#endif
+}  // namespace detail
+
+/// Range over the bits set in a flag, as values of the enumeration, in
+/// increasing order. Each step costs a count of trailing zeros, whatever the
+/// number of unset bits.
+template <class Enum>
+class set_bit_range {
+ public:
+  class iterator {
+   public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Enum;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Enum*;
+    using reference = Enum;
+
+    constexpr iterator() noexcept = default;
+    constexpr explicit iterator(std::uint64_t bits) noexcept : bits_{bits} {}
+
+    constexpr Enum operator*() const noexcept {
+      return detail::flag_from_bits<Enum>(bits_ & (~bits_ + 1));
+    }
+    constexpr iterator& operator++() noexcept {
+      bits_ &= bits_ - 1;
+      return *this;
+    }
+    constexpr iterator operator++(int) noexcept {
+      iterator copy{*this};
+      ++*this;
+      return copy;
+    }
+    constexpr friend bool operator==(iterator left, iterator right) noexcept {
+      return left.bits_ == right.bits_;
+    }
+    constexpr friend bool operator!=(iterator left, iterator right) noexcept {
+      return left.bits_ != right.bits_;
+    }
+
+   private:
+    std::uint64_t bits_{};
+  };
+
+  constexpr explicit set_bit_range(std::uint64_t bits) noexcept : bits_{bits} {}
+
+  constexpr iterator begin() const noexcept { return iterator{bits_}; }
+  constexpr iterator end() const noexcept { return iterator{}; }
+  constexpr std::size_t size() const noexcept { return detail::popcount(bits_); }
+  constexpr bool empty() const noexcept { return bits_ == 0; }
+
+ private:
+  std::uint64_t bits_;
+};
+
+/// Number of bits set in a flag (or in an enumeration value)
+template <class T, detail::enable_if_flag_t<T> = 0>
+constexpr std::size_t count(const T& flags) noexcept {
+  return detail::popcount(detail::flag_bits(flags));
+}
+
+template <class T, detail::enable_if_flag_t<T> = 0>
+constexpr bool any(const T& flags) noexcept {
+  return detail::flag_bits(flags) != 0;
+}
+
+template <class T, detail::enable_if_flag_t<T> = 0>
+constexpr bool none(const T& flags) noexcept {
+  return detail::flag_bits(flags) == 0;
+}
+
+/// True if every bit of the mask is set in flags
+template <class T,
+          class Mask,
+          detail::enable_if_flag_t<T> = 0,
+          detail::enable_if_flag_t<Mask> = 0>
+constexpr bool all_of(const T& flags, const Mask& mask) noexcept {
+  return (detail::flag_bits(flags) & detail::flag_bits(mask)) ==
+         detail::flag_bits(mask);
+}
+
+/// True if at least one bit of the mask is set in flags
+template <class T,
+          class Mask,
+          detail::enable_if_flag_t<T> = 0,
+          detail::enable_if_flag_t<Mask> = 0>
+constexpr bool any_of(const T& flags, const Mask& mask) noexcept {
+  return (detail::flag_bits(flags) & detail::flag_bits(mask)) != 0;
+}
+
+template <class T, detail::enable_if_flag_t<T> = 0>
+constexpr set_bit_range<detail::flag_enum_t<T>> set_bits(
+    const T& flags) noexcept {
+  return set_bit_range<detail::flag_enum_t<T>>{detail::flag_bits(flags)};
+}
+
+/// Calls f with each bit set in flags, as a value of the enumeration
+template <class T, class F, detail::enable_if_flag_t<T> = 0>
+constexpr void for_each_set_bit(const T& flags, F&& f) {
+  for (std::uint64_t bits = detail::flag_bits(flags); bits != 0;
+       bits &= bits - 1) {
+    f(detail::flag_from_bits<detail::flag_enum_t<T>>(bits & (~bits + 1)));
+  }
+}
+
+/// Union of the single bit enumerators declared by Enum (enumerators equal to
+/// 0 or combining several bits are ignored). Deduced from the names of the
+/// enumerators with GCC and Clang. On other compilers, or to restrict the
+/// enumeration, specialize this template with a static constexpr Enum value.
+template <class Enum>
+struct declared_flags {
+  static_assert(std::is_enum<Enum>::value, "declared_flags expects an enum");
+#ifdef DPSG_STRONG_TYPES_ENUMERATOR_PROBE
+  static constexpr Enum value = detail::flag_from_bits<Enum>(
+      detail::declared_bits<Enum>(std::make_index_sequence<
+                                  sizeof(std::underlying_type_t<Enum>) * 8>{}));
+#else
+  static_assert(sizeof(Enum) == 0,
+                "the enumerators can't be deduced with this compiler, "
+                "specialize declared_flags");
+#endif
+};
+
+/// Range over the single bit enumerators of Enum, in increasing order
+template <class Enum>
+constexpr set_bit_range<Enum> enumerators() noexcept {
+  return set_bit_range<Enum>{detail::flag_bits(declared_flags<Enum>::value)};
+}
+
+namespace detail {
+enum class layout_enum : unsigned char {};
+static_assert(
+    is_layout_compatible_with_value_v<flag<layout_enum, struct layout_tag>>,
+    "flag must be layout compatible with its value");
+}  // namespace detail
+
 }  // namespace strong_types
 }  // namespace dpsg
 
@@ -0,0 +1,112 @@
+#ifndef GUARD_DPSG_STRONG_TYPES_FORMAT_HPP
+#define GUARD_DPSG_STRONG_TYPES_FORMAT_HPP
+
+#include <type_traits>
+
+#include <strong_types.hpp>
+#include <strong_types/flags.hpp>
+
+#if __has_include(<format>) && __cplusplus > 201703L
+#include <format>
+#endif
+
+// The formatters of {fmt} are defined when DPSG_STRONG_TYPES_USE_FMT is
+// defined, so that including this header never requires linking with {fmt}
+#ifdef DPSG_STRONG_TYPES_USE_FMT
+#include <fmt/format.h>
+#endif
+
+namespace dpsg {
+namespace strong_types {
+
+/// Formats the strong type as As (with std::format or {fmt}), converting its
+/// value before formatting it. As is the value type by default, and the
+/// underlying type of the enum for flags.
+template <class As>
+struct formattable_as {
+  template <class T>
+  struct type {
+    using formatted_as = As;
+  };
+};
+
+namespace detail {
+template <class T, class = void>
+struct default_formatted_as {
+  using type = value_of_t<T>;
+};
+template <class T>
+struct default_formatted_as<
+    T,
+    std::enable_if_t<std::is_enum<value_of_t<T>>::value>> {
+  using type = std::underlying_type_t<value_of_t<T>>;
+};
+
+template <class T, class = void>
+struct formatted_as : default_formatted_as<T> {};
+template <class T>
+struct formatted_as<T, void_t<typename T::formatted_as>> {
+  using type = typename T::formatted_as;
+};
+template <class T>
+using formatted_as_t = typename formatted_as<T>::type;
+
+template <class As,
+          class T,
+          std::enable_if_t<std::is_same<As, T>::value, int> = 0>
+constexpr const T& formatted_value(const T& value) noexcept {
+  return value;
+}
+template <class As,
+          class T,
+          std::enable_if_t<!std::is_same<As, T>::value, int> = 0>
+constexpr As formatted_value(const T& value) {
+  return static_cast<As>(value);
+}
+
+// Parses the format specification with the formatter of the formatted type,
+// and formats the value with it
+template <class T, class Base>
+struct forwarding_formatter : Base {
+  template <class FormatContext>
+  auto format(const T& value, FormatContext& context) const
+      -> decltype(context.out()) {
+    return Base::format(
+        formatted_value<formatted_as_t<T>>(get_value_t{}(value)), context);
+  }
+};
+}  // namespace detail
+
+}  // namespace strong_types
+}  // namespace dpsg
+
+#define DPSG_STRONG_TYPES_DEFINE_FORMATTER(formatter, strong_type)         \
+  template <class Type, class Tag, class... Params, class Char>            \
+  struct formatter<::dpsg::strong_types::strong_type<Type, Tag, Params...>, \
+                   Char>                                                    \
+      : ::dpsg::strong_types::detail::forwarding_formatter<                 \
+            ::dpsg::strong_types::strong_type<Type, Tag, Params...>,        \
+            formatter<::dpsg::strong_types::detail::formatted_as_t<         \
+                          ::dpsg::strong_types::strong_type<Type, Tag,      \
+                                                            Params...>>,    \
+                      Char>> {};
+
+#ifdef __cpp_lib_format
+namespace std {
+DPSG_STRONG_TYPES_DEFINE_FORMATTER(formatter, strong_value)
+DPSG_STRONG_TYPES_DEFINE_FORMATTER(formatter, number)
+DPSG_STRONG_TYPES_DEFINE_FORMATTER(formatter, flag)
+}  // namespace std
+#endif
+
+#ifdef DPSG_STRONG_TYPES_USE_FMT
+namespace fmt {
+DPSG_STRONG_TYPES_DEFINE_FORMATTER(formatter, strong_value)
+DPSG_STRONG_TYPES_DEFINE_FORMATTER(formatter, number)
+DPSG_STRONG_TYPES_DEFINE_FORMATTER(formatter, flag)
+}  // namespace fmt
+#endif
+
+#undef DPSG_STRONG_TYPES_DEFINE_FORMATTER
+
+#endif  // GUARD_DPSG_STRONG_TYPES_FORMAT_HPP
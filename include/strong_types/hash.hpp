@@ -2,10 +2,21 @@
 #define GUARD_DPSG_STRONG_TYPES_HASH_HPP
 
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <type_traits>
 
 #include <strong_types.hpp>
 
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+namespace std {
+  template<class T>
+    struct hash;
+}  // namespace std
+
 namespace dpsg {
 namespace strong_types {
 
@@ -24,11 +35,214 @@ struct hashable {
   };
 };
 
+/// Same as hashable, but the values are hashed with Hasher instead of
+/// std::hash. Hasher must be default constructible and callable with the value.
+template <class Hasher>
+struct hashable_with {
+  template <class T>
+  struct type {
+    using hashable = typename detail::get_first<T>::type;
+    using hasher = Hasher;
+  };
+};
+
+namespace detail {
+// Full 64 x 64 -> 128 bits multiplication, returning the high and low halves
+inline void multiply(std::uint64_t& low, std::uint64_t& high) noexcept {
+#if defined(__SIZEOF_INT128__)
+  __extension__ using uint128 = unsigned __int128;
+  const uint128 r = static_cast<uint128>(low) * high;
+  low = static_cast<std::uint64_t>(r);
+  high = static_cast<std::uint64_t>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  low = _umul128(low, high, &high);
+#else
+  const std::uint64_t ll = (low & 0xffffffff) * (high & 0xffffffff);
+  const std::uint64_t lh = (low & 0xffffffff) * (high >> 32);
+  const std::uint64_t hl = (low >> 32) * (high & 0xffffffff);
+  const std::uint64_t hh = (low >> 32) * (high >> 32);
+  const std::uint64_t middle = (ll >> 32) + (lh & 0xffffffff) + hl;
+  low = (middle << 32) | (ll & 0xffffffff);
+  high = hh + (lh >> 32) + (middle >> 32);
+#endif
+}
+
+inline std::uint64_t multiply_fold(std::uint64_t a, std::uint64_t b) noexcept {
+  multiply(a, b);
+  return a ^ b;
+}
+
+template <class T>
+inline std::uint64_t read(const unsigned char* p) noexcept {
+  T v;
+  std::memcpy(&v, p, sizeof(T));
+  return v;
+}
+
+template <class T>
+using integral_bits_t = std::conditional_t<std::is_enum<T>::value,
+                                           std::underlying_type<T>,
+                                           std::common_type<T>>;
+
+template <class T>
+constexpr std::uint64_t to_bits(T value) noexcept {
+  return static_cast<std::uint64_t>(
+      static_cast<typename integral_bits_t<T>::type>(value));
+}
+
+template <class T>
+using enable_if_integral_t =
+    std::enable_if_t<std::is_integral<T>::value || std::is_enum<T>::value, int>;
+
+template <class T, class = void>
+struct is_contiguous_bytes : std::false_type {};
+template <class T>
+struct is_contiguous_bytes<
+    T,
+    void_t<decltype(std::declval<const T&>().data()),
+           decltype(std::declval<const T&>().size())>>
+    : std::integral_constant<
+          bool,
+          std::is_trivially_copyable<std::remove_cv_t<std::remove_pointer_t<
+              decltype(std::declval<const T&>().data())>>>::value> {};
+}  // namespace detail
+
+/// Multiplies by 2^64 / phi and folds the high bits of the product into the
+/// low bits. Very cheap, and spreads sequential values over the whole range,
+/// including the low bits used by power of two tables.
+struct fibonacci_hash {
+  template <class T, detail::enable_if_integral_t<T> = 0>
+  constexpr std::size_t operator()(T value) const noexcept {
+    return static_cast<std::size_t>(
+        (detail::to_bits(value) * 0x9e3779b97f4a7c15ull) ^
+        ((detail::to_bits(value) * 0x9e3779b97f4a7c15ull) >> 32));
+  }
+};
+
+/// The finalizer of splitmix64: every bit of the value affects every bit of
+/// the hash, at the cost of two multiplications.
+struct mix_hash {
+  template <class T, detail::enable_if_integral_t<T> = 0>
+  constexpr std::size_t operator()(T value) const noexcept {
+    return static_cast<std::size_t>(mix(detail::to_bits(value)));
+  }
+
+ private:
+  static constexpr std::uint64_t mix(std::uint64_t x) noexcept {
+    return finish((x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull);
+  }
+  static constexpr std::uint64_t finish(std::uint64_t x) noexcept {
+    return last((x ^ (x >> 27)) * 0x94d049bb133111ebull);
+  }
+  static constexpr std::uint64_t last(std::uint64_t x) noexcept {
+    return x ^ (x >> 31);
+  }
+};
+
+/// Hash of contiguous sequences of trivially copyable values (strings, string
+/// views, vectors...) in the style of wyhash: 16 bytes at a time folded by
+/// 128 bits multiplications. Integers are hashed as their 8 bytes.
+struct wy_hash {
+  // Equal sequences of characters have the same hash, whatever their type
+  using is_transparent = void;
+
+  template <class T,
+            std::enable_if_t<detail::is_contiguous_bytes<T>::value, int> = 0>
+  std::size_t operator()(const T& value) const noexcept {
+    using element =
+        std::remove_pointer_t<decltype(std::declval<const T&>().data())>;
+    return bytes(value.data(), value.size() * sizeof(element));
+  }
+
+  template <class T, detail::enable_if_integral_t<T> = 0>
+  std::size_t operator()(T value) const noexcept {
+    const std::uint64_t bits = detail::to_bits(value);
+    return static_cast<std::size_t>(detail::multiply_fold(
+        detail::multiply_fold(bits ^ secret0, seed ^ secret1) ^ secret0 ^
+            8,
+        secret1));
+  }
+
+  std::size_t operator()(const char* str) const noexcept {
+    return bytes(str, std::strlen(str));
+  }
+
+  static std::size_t bytes(const void* data, std::size_t size) noexcept {
+    using detail::multiply_fold;
+    using detail::read;
+    const auto* p = static_cast<const unsigned char*>(data);
+    std::uint64_t s = seed ^ multiply_fold(seed ^ secret0, secret1);
+    std::uint64_t a = 0;
+    std::uint64_t b = 0;
+    if (size <= 16) {
+      if (size >= 4) {
+        const std::size_t offset = (size >> 3) << 2;
+        a = (read<std::uint32_t>(p) << 32) | read<std::uint32_t>(p + offset);
+        b = (read<std::uint32_t>(p + size - 4) << 32) |
+            read<std::uint32_t>(p + size - 4 - offset);
+      }
+      else if (size > 0) {
+        a = (std::uint64_t{p[0]} << 16) | (std::uint64_t{p[size >> 1]} << 8) |
+            p[size - 1];
+      }
+    }
+    else {
+      std::size_t i = size;
+      if (i > 48) {
+        std::uint64_t s1 = s;
+        std::uint64_t s2 = s;
+        do {
+          s = multiply_fold(read<std::uint64_t>(p) ^ secret1,
+                            read<std::uint64_t>(p + 8) ^ s);
+          s1 = multiply_fold(read<std::uint64_t>(p + 16) ^ secret2,
+                             read<std::uint64_t>(p + 24) ^ s1);
+          s2 = multiply_fold(read<std::uint64_t>(p + 32) ^ secret3,
+                             read<std::uint64_t>(p + 40) ^ s2);
+          p += 48;
+          i -= 48;
+        } while (i > 48);
+        s ^= s1 ^ s2;
+      }
+      while (i > 16) {
+        s = multiply_fold(read<std::uint64_t>(p) ^ secret1,
+                          read<std::uint64_t>(p + 8) ^ s);
+        i -= 16;
+        p += 16;
+      }
+      a = read<std::uint64_t>(p + i - 16);
+      b = read<std::uint64_t>(p + i - 8);
+    }
+    a ^= secret1;
+    b ^= s;
+    detail::multiply(a, b);
+    return static_cast<std::size_t>(
+        multiply_fold(a ^ secret0 ^ size, b ^ secret1));
+  }
+
+ private:
+  static constexpr std::uint64_t seed = 0;
+  static constexpr std::uint64_t secret0 = 0xa0761d6478bd642full;
+  static constexpr std::uint64_t secret1 = 0xe7037ed1a0b428dbull;
+  static constexpr std::uint64_t secret2 = 0x8ebc6af09c88c6e3ull;
+  static constexpr std::uint64_t secret3 = 0x589965cc75374cc3ull;
+};
+
 namespace detail {
   template<class T, class Enable = void>
     struct is_hashable : std::false_type {};
   template<class T>
     struct is_hashable<T, void_t<typename T::hashable>> : std::true_type {};
+
+  template <class T, class Enable = void>
+  struct hasher_of {
+    using type = std::hash<typename T::hashable>;
+  };
+  template <class T>
+  struct hasher_of<T, void_t<typename T::hasher>> {
+    using type = typename T::hasher;
+  };
+  template <class T>
+  using hasher_of_t = typename hasher_of<T>::type;
 }
 
 template<class T>
@@ -47,13 +261,11 @@ concept Hashable = requires(T obj) {
 }  // namespace dpsg
 
 namespace std {
-  template<class T>
-    struct hash;
 #ifdef __cpp_concepts
 template <::dpsg::strong_types::Hashable T>
 struct hash<T> {
   std::size_t operator()(const T& value) const {
-    return std::hash<typename T::hashable>{}(
+    return ::dpsg::strong_types::detail::hasher_of_t<T>{}(
         ::dpsg::strong_types::get_value_t{}(value));
   }
 };
@@ -64,7 +276,7 @@ struct hash<T> {
   template <>                                \
   struct hash<type> {                        \
     std::size_t operator()(const type& value) const { \
-      return std::hash<typename type::hashable>{}(value.value); \
+      return ::dpsg::strong_types::detail::hasher_of_t<type>{}(value.value); \
     } \
   }; \
   }
@@ -0,0 +1,229 @@
+#ifndef GUARD_DPSG_STRONG_TYPES_ID_CONTAINERS_HPP
+#define GUARD_DPSG_STRONG_TYPES_ID_CONTAINERS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <strong_types.hpp>
+#include <strong_types/bits.hpp>
+
+namespace dpsg {
+namespace strong_types {
+
+namespace detail {
+template <class Id>
+struct check_id {
+  static_assert(has_value<Id>::value, "the index must be a strong type");
+  static_assert(std::is_integral<value_of_t<Id>>::value &&
+                    !std::is_same<value_of_t<Id>, bool>::value,
+                "the value of the index must be an integer");
+};
+
+template <class Id>
+constexpr std::size_t index_of(const Id& id) noexcept {
+  return static_cast<std::size_t>(get_value_t{}(id));
+}
+
+template <class Id>
+constexpr Id id_at(std::size_t index) noexcept {
+  return Id{static_cast<value_of_t<Id>>(index)};
+}
+}  // namespace detail
+
+/// Contiguous sequence of T indexed by the strong identifier Id. Elements are
+/// accessed directly at the position given by the value of the id, so Id
+/// should be a dense integer sequence starting at 0. Indexing with anything
+/// but an Id does not compile.
+template <class Id, class T, class Allocator = std::allocator<T>>
+class id_vector : detail::check_id<Id> {
+  using container = std::vector<T, Allocator>;
+
+ public:
+  using id_type = Id;
+  using value_type = T;
+  using size_type = typename container::size_type;
+  using reference = typename container::reference;
+  using const_reference = typename container::const_reference;
+  using iterator = typename container::iterator;
+  using const_iterator = typename container::const_iterator;
+
+  id_vector() = default;
+  explicit id_vector(size_type size) : values_(size) {}
+  id_vector(size_type size, const T& value) : values_(size, value) {}
+
+  reference operator[](const Id& id) noexcept {
+    return values_[detail::index_of(id)];
+  }
+  const_reference operator[](const Id& id) const noexcept {
+    return values_[detail::index_of(id)];
+  }
+
+  /// Throws std::out_of_range if the vector has no element for id
+  reference at(const Id& id) { return values_.at(detail::index_of(id)); }
+  const_reference at(const Id& id) const {
+    return values_.at(detail::index_of(id));
+  }
+
+  bool contains(const Id& id) const noexcept {
+    return detail::index_of(id) < values_.size();
+  }
+
+  /// Appends an element and returns its id
+  template <class... Args>
+  Id emplace_back(Args&&... args) {
+    values_.emplace_back(std::forward<Args>(args)...);
+    return detail::id_at<Id>(values_.size() - 1);
+  }
+  Id push_back(const T& value) { return emplace_back(value); }
+  Id push_back(T&& value) { return emplace_back(std::move(value)); }
+
+  /// Id of the next element to be appended
+  Id next_id() const noexcept { return detail::id_at<Id>(values_.size()); }
+
+  /// Calls f(id, element) for every element
+  template <class F>
+  void for_each(F&& f) {
+    for (size_type i = 0; i < values_.size(); ++i) {
+      f(detail::id_at<Id>(i), values_[i]);
+    }
+  }
+  template <class F>
+  void for_each(F&& f) const {
+    for (size_type i = 0; i < values_.size(); ++i) {
+      f(detail::id_at<Id>(i), values_[i]);
+    }
+  }
+
+  void resize(size_type size) { values_.resize(size); }
+  void resize(size_type size, const T& value) { values_.resize(size, value); }
+  void reserve(size_type capacity) { values_.reserve(capacity); }
+  void clear() noexcept { values_.clear(); }
+
+  size_type size() const noexcept { return values_.size(); }
+  size_type capacity() const noexcept { return values_.capacity(); }
+  bool empty() const noexcept { return values_.empty(); }
+
+  T* data() noexcept { return values_.data(); }
+  const T* data() const noexcept { return values_.data(); }
+
+  iterator begin() noexcept { return values_.begin(); }
+  iterator end() noexcept { return values_.end(); }
+  const_iterator begin() const noexcept { return values_.begin(); }
+  const_iterator end() const noexcept { return values_.end(); }
+  const_iterator cbegin() const noexcept { return values_.cbegin(); }
+  const_iterator cend() const noexcept { return values_.cend(); }
+
+ private:
+  container values_;
+};
+
+/// Set of strong identifiers Id, stored as one bit per possible id. The set
+/// grows to hold the largest id inserted.
+template <class Id, class Allocator = std::allocator<std::uint64_t>>
+class id_bitset : detail::check_id<Id> {
+  using word = std::uint64_t;
+  static constexpr std::size_t word_size = 64;
+
+ public:
+  using id_type = Id;
+  using size_type = std::size_t;
+
+  id_bitset() = default;
+  /// Reserves room for the ids 0 to size - 1
+  explicit id_bitset(size_type size) : words_(word_count(size)) {}
+
+  bool contains(const Id& id) const noexcept {
+    const std::size_t index = detail::index_of(id);
+    return index / word_size < words_.size() &&
+           (words_[index / word_size] & mask(index)) != 0;
+  }
+
+  /// Returns true if id was not in the set
+  bool insert(const Id& id) {
+    const std::size_t index = detail::index_of(id);
+    if (index / word_size >= words_.size()) {
+      words_.resize(index / word_size + 1);
+    }
+    word& w = words_[index / word_size];
+    const bool inserted = (w & mask(index)) == 0;
+    w |= mask(index);
+    return inserted;
+  }
+
+  /// Returns true if id was in the set
+  bool erase(const Id& id) noexcept {
+    const std::size_t index = detail::index_of(id);
+    if (index / word_size >= words_.size()) {
+      return false;
+    }
+    word& w = words_[index / word_size];
+    const bool erased = (w & mask(index)) != 0;
+    w &= ~mask(index);
+    return erased;
+  }
+
+  /// Number of ids in the set
+  size_type count() const noexcept {
+    size_type result = 0;
+    for (word w : words_) {
+      result += detail::popcount(w);
+    }
+    return result;
+  }
+
+  bool empty() const noexcept {
+    for (word w : words_) {
+      if (w != 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  /// Number of ids that the set can hold without growing
+  size_type capacity() const noexcept { return words_.size() * word_size; }
+
+  void reserve(size_type size) {
+    if (word_count(size) > words_.size()) {
+      words_.resize(word_count(size));
+    }
+  }
+
+  void clear() noexcept {
+    for (word& w : words_) {
+      w = 0;
+    }
+  }
+
+  /// Calls f(id) for every id of the set, in increasing order
+  template <class F>
+  void for_each(F&& f) const {
+    for (std::size_t i = 0; i < words_.size(); ++i) {
+      for (word w = words_[i]; w != 0; w &= w - 1) {
+        f(detail::id_at<Id>(
+            i * word_size +
+            static_cast<std::size_t>(detail::count_trailing_zeros(w))));
+      }
+    }
+  }
+
+ private:
+  static constexpr size_type word_count(size_type size) noexcept {
+    return (size + word_size - 1) / word_size;
+  }
+  static constexpr word mask(std::size_t index) noexcept {
+    return word{1} << (index % word_size);
+  }
+
+  std::vector<word, Allocator> words_;
+};
+
+}  // namespace strong_types
+}  // namespace dpsg
+
+#endif  // GUARD_DPSG_STRONG_TYPES_ID_CONTAINERS_HPP
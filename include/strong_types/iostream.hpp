@@ -1,7 +1,8 @@
 #ifndef GUARD_DPSG_STRONG_TYPES_IOSTREAM_HPP
 #define GUARD_DPSG_STRONG_TYPES_IOSTREAM_HPP
 
-#include <iostream>
+#include <istream>
+#include <ostream>
 #include <strong_types.hpp>
 
 namespace dpsg {
@@ -0,0 +1,131 @@
+#ifndef GUARD_DPSG_STRONG_TYPES_LAYOUT_HPP
+#define GUARD_DPSG_STRONG_TYPES_LAYOUT_HPP
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+#include <strong_types.hpp>
+
+#if __has_include(<span>)
+#include <span>
+#endif
+
+// The library feature macros tested below are defined by <version> (and by
+// <new> before C++20)
+#if __has_include(<version>)
+#include <version>
+#endif
+
+// Using std::hardware_destructive_interference_size in a header makes GCC warn
+// that its value may differ between translation units, GCC exposes the same
+// value as a macro.
+#ifndef DPSG_STRONG_TYPES_CACHE_LINE_SIZE
+#if defined(__GCC_DESTRUCTIVE_SIZE)
+#define DPSG_STRONG_TYPES_CACHE_LINE_SIZE __GCC_DESTRUCTIVE_SIZE
+#elif defined(__cpp_lib_hardware_interference_size)
+#define DPSG_STRONG_TYPES_CACHE_LINE_SIZE \
+  std::hardware_destructive_interference_size
+#else
+#define DPSG_STRONG_TYPES_CACHE_LINE_SIZE 64
+#endif
+#endif
+
+namespace dpsg {
+namespace strong_types {
+
+namespace detail {
+template <class From, class To>
+using copy_const_t =
+    std::conditional_t<std::is_const<From>::value, std::add_const_t<To>, To>;
+
+template <class Strong, class Value>
+struct check_layout {
+  static_assert(std::is_same<value_of_t<Strong>, Value>::value,
+                "the strong type must hold a value of this type");
+  static_assert(is_layout_compatible_with_value<Strong>::value,
+                "the strong type must be layout compatible with its value");
+  static_assert(std::is_trivially_copyable<Value>::value,
+                "only arrays of trivially copyable values can be reinterpreted");
+};
+
+// A standard layout object is pointer interconvertible with its first member,
+// so the values can be accessed through a pointer to the strong types.
+template <class Strong>
+auto* values_of(Strong* first) noexcept {
+  using value_type =
+      copy_const_t<Strong, value_of_t<std::remove_const_t<Strong>>>;
+  (void)check_layout<std::remove_const_t<Strong>,
+                     std::remove_const_t<value_type>>{};
+  return reinterpret_cast<value_type*>(first);
+}
+
+// Strong types are implicit-lifetime types when their values are trivially
+// copyable. When the library provides std::start_lifetime_as_array, the strong
+// types are created in place of the values. Otherwise the values are simply
+// reinterpreted, like every compiler allows in practice.
+template <class Strong, class Value>
+copy_const_t<Value, Strong>* strong_types_of(Value* first,
+                                             std::size_t size) noexcept {
+  (void)check_layout<Strong, std::remove_const_t<Value>>{};
+#if defined(__cpp_lib_start_lifetime_as)
+  return std::start_lifetime_as_array<copy_const_t<Value, Strong>>(first, size);
+#elif defined(__cpp_lib_launder)
+  (void)size;
+  return std::launder(reinterpret_cast<copy_const_t<Value, Strong>*>(first));
+#else
+  (void)size;
+  return reinterpret_cast<copy_const_t<Value, Strong>*>(first);
+#endif
+}
+}  // namespace detail
+
+/// View an array of strong types as an array of their values, without copy.
+template <class Strong>
+auto* as_underlying(Strong* first) noexcept {
+  return detail::values_of(first);
+}
+
+/// View an array of values as an array of Strong, without copy.
+template <class Strong, class Value>
+auto* as_strong(Value* first, std::size_t size) noexcept {
+  return detail::strong_types_of<Strong>(first, size);
+}
+
+#ifdef __cpp_lib_span
+/// View a span of strong types as a span of their values, without copy.
+template <class Strong, std::size_t Extent>
+auto as_underlying(std::span<Strong, Extent> strong_types) noexcept {
+  using value_type = std::remove_pointer_t<decltype(detail::values_of(
+      strong_types.data()))>;
+  return std::span<value_type, Extent>(detail::values_of(strong_types.data()),
+                                       strong_types.size());
+}
+
+/// View a span of values as a span of Strong, without copy.
+template <class Strong, class Value, std::size_t Extent>
+auto as_strong(std::span<Value, Extent> values) noexcept {
+  return std::span<detail::copy_const_t<Value, Strong>, Extent>(
+      detail::strong_types_of<Strong>(values.data(), values.size()),
+      values.size());
+}
+#endif
+
+/// Minimum distance between two objects written by different threads for them
+/// not to share a cache line. Define DPSG_STRONG_TYPES_CACHE_LINE_SIZE to
+/// override it.
+constexpr std::size_t cache_line_size = DPSG_STRONG_TYPES_CACHE_LINE_SIZE;
+
+/// Aligns the strong type (and pads its size) to cache_line_size, so that
+/// neighbouring strong types never share a cache line. The strong type is no
+/// longer layout compatible with its value.
+struct cacheline_aligned {
+  template <class T>
+  struct alignas(cache_line_size) type {};
+};
+
+}  // namespace strong_types
+}  // namespace dpsg
+
+#endif  // GUARD_DPSG_STRONG_TYPES_LAYOUT_HPP
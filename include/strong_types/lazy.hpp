@@ -0,0 +1,268 @@
+#ifndef GUARD_DPSG_STRONG_TYPES_LAZY_HPP
+#define GUARD_DPSG_STRONG_TYPES_LAZY_HPP
+
+#include <type_traits>
+#include <utility>
+
+#include <strong_types.hpp>
+
+namespace dpsg {
+namespace strong_types {
+
+namespace detail {
+template <class Type,
+          class Op,
+          class Result,
+          class TransformLeft,
+          class TransformRight,
+          class Left,
+          class Right>
+struct expression;
+
+template <class T>
+struct is_expression : std::false_type {};
+template <class Type, class Op, class Result, class TL, class TR, class L, class R>
+struct is_expression<expression<Type, Op, Result, TL, TR, L, R>>
+    : std::true_type {};
+
+// Operands of an expression are stored by reference when they are lvalues,
+// and by value otherwise so that expressions built from temporaries can be
+// kept. Operands that are neither expressions nor of the expected type are
+// converted, as they would be by an operation set.
+template <class Expected, class T>
+using expression_operand_t = std::conditional_t<
+    is_expression<std::decay_t<T>>::value ||
+        is_same_or_derived<T, Expected>::value,
+    std::conditional_t<std::is_lvalue_reference<T>::value,
+                       const std::remove_reference_t<T>&,
+                       std::decay_t<T>>,
+    Expected>;
+
+// The value of an operand, as seen by the operation. Nested expressions are
+// computed without building their result when the operand would only be
+// unwrapped, so that a whole expression is evaluated in a single pass.
+template <class Transform,
+          class T,
+          std::enable_if_t<!is_expression<std::decay_t<T>>::value, int> = 0>
+constexpr decltype(auto) operand_value(T&& operand) {
+  return Transform{}(std::forward<T>(operand));
+}
+template <class Transform,
+          class T,
+          std::enable_if_t<is_expression<std::decay_t<T>>::value &&
+                               std::is_same<Transform, get_value_t>::value,
+                           int> = 0>
+constexpr decltype(auto) operand_value(T&& operand) {
+  return std::forward<T>(operand).compute();
+}
+template <class Transform,
+          class T,
+          std::enable_if_t<is_expression<std::decay_t<T>>::value &&
+                               !std::is_same<Transform, get_value_t>::value,
+                           int> = 0>
+constexpr auto operand_value(T&& operand) {
+  return Transform{}(std::forward<T>(operand).evaluate());
+}
+
+/// Deferred application of Op to two operands. An expression converts to the
+/// type that the operation would have returned, which is when it is evaluated.
+template <class Type,
+          class Op,
+          class Result,
+          class TransformLeft,
+          class TransformRight,
+          class Left,
+          class Right>
+struct expression {
+  using type = Type;
+
+  Left left;
+  Right right;
+
+  /// The result of the operation on the values, before it is wrapped
+  constexpr decltype(auto) compute() const& {
+    return Op{}(operand_value<TransformLeft>(left),
+                operand_value<TransformRight>(right));
+  }
+  constexpr decltype(auto) compute() && {
+    return Op{}(operand_value<TransformLeft>(static_cast<Left&&>(left)),
+                operand_value<TransformRight>(static_cast<Right&&>(right)));
+  }
+
+  constexpr Type evaluate() const& { return Result{}(compute()); }
+  constexpr Type evaluate() && { return Result{}(std::move(*this).compute()); }
+
+  constexpr operator Type() const& { return evaluate(); }
+  constexpr operator Type() && { return std::move(*this).evaluate(); }
+};
+
+/// Implementation of the operations of a lazy set. Instead of applying the
+/// operation, it records its operands in an expression.
+template <class Left,
+          class Right,
+          class Result,
+          class TransformLeft,
+          class TransformRight>
+struct lazy_binary_operation {
+  using left_type = Left;
+
+  template <class Op, class L, class R>
+  static constexpr auto apply(L&& left, R&& right) {
+    using left_operand = expression_operand_t<Left, L>;
+    using right_operand = expression_operand_t<Right, R>;
+    using type = std::decay_t<decltype(Result{}(
+        Op{}(operand_value<TransformLeft>(std::declval<const left_operand&>()),
+             operand_value<TransformRight>(
+                 std::declval<const right_operand&>()))))>;
+    return expression<type, Op, Result, TransformLeft, TransformRight,
+                      left_operand, right_operand>{
+        static_cast<left_operand>(std::forward<L>(left)),
+        static_cast<right_operand>(std::forward<R>(right))};
+  }
+};
+
+template <class Operations,
+          class Left,
+          class Right,
+          class Result,
+          class TransformLeft = get_value_t,
+          class TransformRight = get_value_t>
+struct implement_lazy_binary_operations;
+
+/// Like implement_binary_operations, but the operators return expressions.
+/// Since an expression converts to the type of its result, the selection of
+/// the operations applies to expressions as it would to their results.
+template <class... Ops,
+          class Left,
+          class Right,
+          class Result,
+          class TransformLeft,
+          class TransformRight>
+struct implement_lazy_binary_operations<black_magic::tuple<Ops...>,
+                                        Left,
+                                        Right,
+                                        Result,
+                                        TransformLeft,
+                                        TransformRight> {
+  static_assert(conjunction<is_binary_operator<Ops>...>::value,
+                "implement_lazy_binary_operations expects binary operators");
+
+  friend constexpr lazy_binary_operation<Left,
+                                         Right,
+                                         Result,
+                                         TransformLeft,
+                                         TransformRight>*
+  select_binary_operation(const Left&,
+                          const Right&,
+                          black_magic::tuple<Ops...>*) noexcept {
+    return nullptr;
+  }
+};
+
+}  // namespace detail
+
+template <class Operations,
+          class Left,
+          class Right,
+          class Result,
+          class TransformLeft = get_value_t,
+          class TransformRight = get_value_t>
+using implement_lazy_binary_operations =
+    detail::implement_lazy_binary_operations<Operations,
+                                             Left,
+                                             Right,
+                                             Result,
+                                             TransformLeft,
+                                             TransformRight>;
+
+template <class Operations,
+          class Left,
+          class Right,
+          class Result,
+          class TransformLeft = get_value_t,
+          class TransformRight = get_value_t>
+struct DPSG_STRONG_TYPES_EMPTY_BASES implement_lazy_commutative_operations
+    : implement_lazy_binary_operations<Operations,
+                                       Left,
+                                       Right,
+                                       Result,
+                                       TransformLeft,
+                                       TransformRight>,
+      implement_lazy_binary_operations<Operations,
+                                       Right,
+                                       Left,
+                                       Result,
+                                       TransformRight,
+                                       TransformLeft> {};
+
+using lazy_arithmetic_operators =
+    black_magic::tuple<plus, minus, multiplies, divides, modulo>;
+using self_assigning_arithmetic_operators = black_magic::tuple<plus_assign,
+                                                               minus_assign,
+                                                               multiplies_assign,
+                                                               divides_assign,
+                                                               modulo_assign>;
+
+/// Same operations as arithmetic, but +, -, *, / and % return expressions
+/// which are evaluated in a single pass when converted to a strong type,
+/// without building (and moving the values through) intermediate strong types.
+struct lazy_arithmetic {
+  template <class Arg>
+  struct DPSG_STRONG_TYPES_EMPTY_BASES type
+      : implement_lazy_binary_operations<lazy_arithmetic_operators,
+                                         Arg,
+                                         Arg,
+                                         construct_t<Arg>>,
+        implement_binary_operations<self_assigning_arithmetic_operators,
+                                    Arg,
+                                    Arg,
+                                    construct_t<Arg>>,
+        implement_unary_operations<unary_arithmetic_operators,
+                                   Arg,
+                                   construct_t<Arg>> {};
+};
+
+/// Same operations as arithmetically_compatible_with, but +, -, *, / and %
+/// return expressions.
+template <class Arg2,
+          class R = black_magic::deduce,
+          class T1 = get_value_t,
+          class T2 = get_value_t>
+struct lazily_compatible_with {
+  template <class Arg1>
+  struct DPSG_STRONG_TYPES_EMPTY_BASES type
+      : implement_lazy_commutative_operations<
+            lazy_arithmetic_operators,
+            Arg1,
+            Arg2,
+            black_magic::deduce_return_type<R, construct_t<Arg1>, Arg1>,
+            T1,
+            T2>,
+        implement_commutative_operations<
+            self_assigning_arithmetic_operators,
+            Arg1,
+            Arg2,
+            black_magic::deduce_return_type<R, construct_t<Arg1>, Arg1>,
+            T1,
+            T2> {};
+};
+
+/// Evaluates an expression, and returns any other value unchanged. Useful to
+/// store the result of an operation with auto.
+template <class T,
+          std::enable_if_t<detail::is_expression<std::decay_t<T>>::value,
+                           int> = 0>
+constexpr auto evaluate(T&& t) {
+  return std::forward<T>(t).evaluate();
+}
+template <class T,
+          std::enable_if_t<!detail::is_expression<std::decay_t<T>>::value,
+                           int> = 0>
+constexpr T evaluate(T&& t) {
+  return std::forward<T>(t);
+}
+
+}  // namespace strong_types
+}  // namespace dpsg
+
+#endif  // GUARD_DPSG_STRONG_TYPES_LAZY_HPP
@@ -0,0 +1,332 @@
+#ifndef GUARD_DPSG_STRONG_TYPES_MAPPED_ARRAY_HPP
+#define GUARD_DPSG_STRONG_TYPES_MAPPED_ARRAY_HPP
+
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <strong_types.hpp>
+#include <strong_types/layout.hpp>
+
+#if __has_include(<span>) && __cplusplus > 201703L
+#include <span>
+#endif
+
+// Files are mapped with the POSIX interface
+#if __has_include(<sys/mman.h>) && __has_include(<unistd.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DPSG_STRONG_TYPES_MAPPED_ARRAY
+
+namespace dpsg {
+namespace strong_types {
+
+namespace detail {
+template <class T>
+struct tag_of {
+  using type = T;
+};
+template <template <class, class, class...> class Strong,
+          class Type,
+          class Tag,
+          class... Params>
+struct tag_of<Strong<Type, Tag, Params...>> {
+  using type = Tag;
+};
+
+constexpr std::uint64_t fnv1a(
+    const char* first,
+    std::size_t size,
+    std::uint64_t hash = 0xcbf29ce484222325ull) noexcept {
+  for (std::size_t i = 0; i < size; ++i) {
+    hash = (hash ^ static_cast<unsigned char>(first[i])) * 0x100000001b3ull;
+  }
+  return hash;
+}
+
+// The signature of the function names the tag and the value type, as spelled
+// by the compiler
+template <class Tag, class Value>
+constexpr std::uint64_t signature_hash() noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return fnv1a(__PRETTY_FUNCTION__, sizeof(__PRETTY_FUNCTION__) - 1);
+#elif defined(_MSC_VER)
+  return fnv1a(__FUNCSIG__, sizeof(__FUNCSIG__) - 1);
+#else
+  return 0;
+#endif
+}
+
+struct mapped_array_header {
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t header_size;
+  std::uint64_t fingerprint;
+  std::uint64_t size;
+  std::uint32_t element_size;
+  std::uint32_t element_alignment;
+};
+
+constexpr char mapped_array_magic[8] = {'d', 'p', 's', 'g', 's', 't', 'm', 'a'};
+constexpr std::uint32_t mapped_array_version = 1;
+// The values start at the same offset in every file, aligned for any type
+constexpr std::size_t mapped_array_header_size = 64;
+static_assert(sizeof(mapped_array_header) <= mapped_array_header_size,
+              "the header must fit before the values");
+
+[[noreturn]] inline void throw_mapping_error(const char* what,
+                                             const char* path) {
+  throw std::system_error(errno, std::generic_category(),
+                          std::string(what) + " " + path);
+}
+
+[[noreturn]] inline void throw_format_error(const char* what,
+                                            const char* path) {
+  throw std::runtime_error(std::string(path) + ": " + what);
+}
+
+// Owns a file descriptor until the file is mapped
+class file_descriptor {
+ public:
+  explicit file_descriptor(int fd) noexcept : fd_{fd} {}
+  file_descriptor(const file_descriptor&) = delete;
+  file_descriptor& operator=(const file_descriptor&) = delete;
+  ~file_descriptor() {
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+  }
+  int get() const noexcept { return fd_; }
+
+ private:
+  int fd_;
+};
+}  // namespace detail
+
+/// Identifies the type of the values of a mapped array in its file. By
+/// default, a hash of the names of the tag and of the value type of T given by
+/// the compiler (so files are only portable between compilers spelling them
+/// the same way), combined with the size of the values. Specialize to give
+/// stable fingerprints to the types stored in files.
+template <class T>
+struct type_fingerprint
+    : std::integral_constant<
+          std::uint64_t,
+          detail::signature_hash<typename detail::tag_of<T>::type,
+                                 detail::value_of_t<T>>() ^
+              sizeof(T)> {};
+
+/// An array of strong types stored in a file and mapped in memory: the pages
+/// of the file are only read when the values are accessed. mapped_array<T>
+/// maps the file for reading and writing, mapped_array<const T> for reading
+/// only. The file starts with a header recording the number of values, their
+/// size and alignment and the fingerprint of their type, which are checked
+/// when the file is opened.
+template <class T>
+class mapped_array {
+  using strong_type = std::remove_const_t<T>;
+  static_assert(std::is_trivially_copyable<strong_type>::value &&
+                    std::is_standard_layout<strong_type>::value,
+                "only trivially copyable standard layout types can be mapped");
+  static_assert(is_layout_compatible_with_value<strong_type>::value,
+                "the strong type must be layout compatible with its value");
+  static_assert(alignof(strong_type) <= detail::mapped_array_header_size,
+                "the values are aligned on the size of the header at most");
+
+ public:
+  using element_type = T;
+  using value_type = strong_type;
+  using size_type = std::size_t;
+  using pointer = T*;
+  using reference = T&;
+  using iterator = T*;
+
+  static constexpr std::uint64_t fingerprint =
+      type_fingerprint<strong_type>::value;
+
+  constexpr mapped_array() noexcept = default;
+
+  /// Maps an existing file, throwing std::system_error if it can't be opened
+  /// or mapped, and std::runtime_error if its header doesn't match T or its
+  /// size doesn't match the header.
+  // Delegating to the default constructor unmaps the file when a check fails
+  explicit mapped_array(const char* path) : mapped_array() {
+    constexpr bool writable = !std::is_const<T>::value;
+    detail::file_descriptor fd{::open(path, writable ? O_RDWR : O_RDONLY)};
+    if (fd.get() < 0) {
+      detail::throw_mapping_error("cannot open", path);
+    }
+    struct stat status;
+    if (::fstat(fd.get(), &status) != 0) {
+      detail::throw_mapping_error("cannot stat", path);
+    }
+    const auto file_size = static_cast<std::size_t>(status.st_size);
+    if (file_size < detail::mapped_array_header_size) {
+      detail::throw_format_error("too small for a mapped array", path);
+    }
+    map(fd.get(), file_size, writable, path);
+
+    const detail::mapped_array_header& header = this->header();
+    if (std::memcmp(header.magic, detail::mapped_array_magic,
+                    sizeof(header.magic)) != 0 ||
+        header.version != detail::mapped_array_version ||
+        header.header_size != detail::mapped_array_header_size) {
+      detail::throw_format_error("not a mapped array", path);
+    }
+    if (header.fingerprint != fingerprint ||
+        header.element_size != sizeof(strong_type) ||
+        header.element_alignment != alignof(strong_type)) {
+      detail::throw_format_error("values of a different type", path);
+    }
+    if (header.size > (file_size - detail::mapped_array_header_size) /
+                          sizeof(strong_type) ||
+        file_size != detail::mapped_array_header_size +
+                         header.size * sizeof(strong_type)) {
+      detail::throw_format_error("size does not match its header", path);
+    }
+    size_ = static_cast<std::size_t>(header.size);
+  }
+  explicit mapped_array(const std::string& path)
+      : mapped_array(path.c_str()) {}
+
+  /// Creates (or replaces) the file, sized for size value-initialized values,
+  /// and maps it for reading and writing.
+  template <class U = T, std::enable_if_t<!std::is_const<U>::value, int> = 0>
+  static mapped_array create(const char* path, std::size_t size) {
+    detail::file_descriptor fd{
+        ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644)};
+    if (fd.get() < 0) {
+      detail::throw_mapping_error("cannot create", path);
+    }
+    const std::size_t file_size =
+        detail::mapped_array_header_size + size * sizeof(strong_type);
+    if (::ftruncate(fd.get(), static_cast<off_t>(file_size)) != 0) {
+      detail::throw_mapping_error("cannot resize", path);
+    }
+    mapped_array result;
+    result.map(fd.get(), file_size, true, path);
+    result.size_ = size;
+
+    detail::mapped_array_header header{};
+    std::memcpy(header.magic, detail::mapped_array_magic, sizeof(header.magic));
+    header.version = detail::mapped_array_version;
+    header.header_size = detail::mapped_array_header_size;
+    header.fingerprint = fingerprint;
+    header.size = size;
+    header.element_size = sizeof(strong_type);
+    header.element_alignment = alignof(strong_type);
+    std::memcpy(result.address_, &header, sizeof(header));
+    // The file is filled with zeros, which are not the value-initialized
+    // values of every type
+    for (std::size_t i = 0; i < size; ++i) {
+      new (result.data() + i) strong_type{};
+    }
+    return result;
+  }
+  template <class U = T, std::enable_if_t<!std::is_const<U>::value, int> = 0>
+  static mapped_array create(const std::string& path, std::size_t size) {
+    return create(path.c_str(), size);
+  }
+
+  mapped_array(mapped_array&& other) noexcept
+      : address_{std::exchange(other.address_, nullptr)},
+        mapped_size_{std::exchange(other.mapped_size_, 0)},
+        size_{std::exchange(other.size_, 0)} {}
+
+  mapped_array& operator=(mapped_array&& other) noexcept {
+    mapped_array moved{std::move(other)};
+    swap(moved);
+    return *this;
+  }
+
+  ~mapped_array() {
+    if (address_ != nullptr) {
+      ::munmap(address_, mapped_size_);
+    }
+  }
+
+  void swap(mapped_array& other) noexcept {
+    std::swap(address_, other.address_);
+    std::swap(mapped_size_, other.mapped_size_);
+    std::swap(size_, other.size_);
+  }
+
+  /// Writes the modified pages back to the file before returning
+  template <class U = T, std::enable_if_t<!std::is_const<U>::value, int> = 0>
+  void flush() {
+    if (address_ != nullptr && ::msync(address_, mapped_size_, MS_SYNC) != 0) {
+      throw std::system_error(errno, std::generic_category(),
+                              "cannot write the mapped array");
+    }
+  }
+
+  T* data() const noexcept {
+    if (address_ == nullptr) {
+      return nullptr;
+    }
+    using byte_type = detail::copy_const_t<T, unsigned char>;
+    using raw_type = detail::copy_const_t<T, detail::value_of_t<strong_type>>;
+    return as_strong<strong_type>(
+        reinterpret_cast<raw_type*>(static_cast<byte_type*>(address_) +
+                                      detail::mapped_array_header_size),
+        size_);
+  }
+  std::size_t size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+
+  T* begin() const noexcept { return data(); }
+  T* end() const noexcept { return data() + size_; }
+
+  /// Expects i < size()
+  T& operator[](std::size_t i) const noexcept {
+    assert(i < size_);
+    return data()[i];
+  }
+
+#ifdef __cpp_lib_span
+  std::span<T> span() const noexcept { return {data(), size_}; }
+  operator std::span<T>() const noexcept { return span(); }
+#endif
+
+ private:
+  void map(int fd, std::size_t file_size, bool writable, const char* path) {
+    const int protection = writable ? PROT_READ | PROT_WRITE : PROT_READ;
+    void* address =
+        ::mmap(nullptr, file_size, protection, MAP_SHARED, fd, 0);
+    if (address == MAP_FAILED) {
+      detail::throw_mapping_error("cannot map", path);
+    }
+    address_ = address;
+    mapped_size_ = file_size;
+  }
+
+  const detail::mapped_array_header& header() const noexcept {
+    return *static_cast<const detail::mapped_array_header*>(address_);
+  }
+
+  void* address_{nullptr};
+  std::size_t mapped_size_{0};
+  std::size_t size_{0};
+};
+
+template <class T>
+void swap(mapped_array<T>& left, mapped_array<T>& right) noexcept {
+  left.swap(right);
+}
+
+}  // namespace strong_types
+}  // namespace dpsg
+
+#endif  // __has_include(<sys/mman.h>)
+
+#endif  // GUARD_DPSG_STRONG_TYPES_MAPPED_ARRAY_HPP
@@ -0,0 +1,272 @@
+#ifndef GUARD_DPSG_STRONG_TYPES_SLOT_MAP_HPP
+#define GUARD_DPSG_STRONG_TYPES_SLOT_MAP_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <strong_types.hpp>
+#include <strong_types/hash.hpp>
+
+namespace dpsg {
+namespace strong_types {
+
+namespace detail {
+template <unsigned Bits>
+using packed_handle_t =
+    std::conditional_t<(Bits <= 32), std::uint32_t, std::uint64_t>;
+
+template <class T>
+constexpr T low_bits_mask(unsigned bits) noexcept {
+  return bits >= sizeof(T) * 8 ? static_cast<T>(~T{0})
+                               : static_cast<T>((T{1} << bits) - 1);
+}
+}  // namespace detail
+
+/// Identifier packing the index of a slot and the generation of the slot,
+/// incremented every time the slot is freed, in a single integer. Handles are
+/// comparable and hashable.
+template <class Tag, unsigned IndexBits = 32, unsigned GenerationBits = 32>
+struct handle : strong_value<detail::packed_handle_t<IndexBits + GenerationBits>,
+                             Tag,
+                             comparable,
+                             hashable> {
+  static_assert(IndexBits > 0 && GenerationBits > 0,
+                "handles need both an index and a generation");
+  static_assert(IndexBits + GenerationBits <= 64,
+                "handles must fit in 64 bits");
+
+  using value_type = detail::packed_handle_t<IndexBits + GenerationBits>;
+  using base = strong_value<value_type, Tag, comparable, hashable>;
+
+  static constexpr unsigned index_bits = IndexBits;
+  static constexpr unsigned generation_bits = GenerationBits;
+  static constexpr value_type index_mask =
+      detail::low_bits_mask<value_type>(IndexBits);
+  static constexpr value_type generation_mask =
+      detail::low_bits_mask<value_type>(GenerationBits);
+
+  /// The null handle, never returned by a slot_map
+  constexpr handle() noexcept = default;
+
+  constexpr handle(value_type index, value_type generation) noexcept
+      : base{static_cast<value_type>((index & index_mask) |
+                                     ((generation & generation_mask)
+                                      << IndexBits))} {}
+
+  constexpr value_type index() const noexcept {
+    return this->value & index_mask;
+  }
+  constexpr value_type generation() const noexcept {
+    return (this->value >> IndexBits) & generation_mask;
+  }
+};
+
+/// Container of T giving out handles on insertion. Insertion, erasure and
+/// lookup are O(1), values are stored contiguously (in no particular order),
+/// and handles to erased values are detected by their generation.
+template <class Handle, class T, class Allocator = std::allocator<T>>
+class slot_map {
+  using index_type = typename Handle::value_type;
+
+  struct slot {
+    // Position of the value when the slot is used, next free slot otherwise
+    index_type position;
+    index_type generation;
+  };
+
+  template <class U>
+  using rebind =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<U>;
+
+ public:
+  using handle_type = Handle;
+  using value_type = T;
+  using size_type = std::size_t;
+  using iterator = typename std::vector<T, Allocator>::iterator;
+  using const_iterator = typename std::vector<T, Allocator>::const_iterator;
+
+  /// Inserts a value built from args and returns its handle. Throws
+  /// std::length_error if every index of Handle is used. The map is left
+  /// unchanged if the value can't be constructed or stored.
+  // The other vectors are grown before the value is constructed, so that
+  // nothing can throw once it is stored
+  template <class... Args>
+  Handle emplace(Args&&... args) {
+    index_type index = free_;
+    if (index == none) {
+      if (slots_.size() > Handle::index_mask) {
+        throw std::length_error("slot_map: no index left for a new handle");
+      }
+      reserve_one_more(slots_);
+      index = static_cast<index_type>(slots_.size());
+    }
+    reserve_one_more(owners_);
+    values_.emplace_back(std::forward<Args>(args)...);
+    if (index == slots_.size()) {
+      slots_.push_back(slot{0, 1});
+    }
+    owners_.push_back(index);
+    slot& s = slots_[index];
+    if (index == free_) {
+      free_ = s.position;
+    }
+    s.position = static_cast<index_type>(values_.size() - 1);
+    return Handle{index, s.generation};
+  }
+  Handle insert(const T& value) { return emplace(value); }
+  Handle insert(T&& value) { return emplace(std::move(value)); }
+
+  /// Returns true if the handle referred to a value of the map
+  bool erase(const Handle& h) {
+    if (!contains(h)) {
+      return false;
+    }
+    slot& s = slots_[h.index()];
+    const index_type position = s.position;
+    if (position + 1 != values_.size()) {
+      values_[position] = std::move(values_.back());
+      owners_[position] = owners_.back();
+      slots_[owners_[position]].position = position;
+    }
+    values_.pop_back();
+    owners_.pop_back();
+    release(h.index());
+    return true;
+  }
+
+  bool contains(const Handle& h) const noexcept {
+    return h.index() < slots_.size() &&
+           slots_[h.index()].generation == h.generation();
+  }
+
+  /// Pointer to the value of the handle, or nullptr if it was erased
+  T* find(const Handle& h) noexcept {
+    return contains(h) ? &values_[slots_[h.index()].position] : nullptr;
+  }
+  const T* find(const Handle& h) const noexcept {
+    return contains(h) ? &values_[slots_[h.index()].position] : nullptr;
+  }
+
+  /// The handle must refer to a value of the map
+  T& operator[](const Handle& h) noexcept {
+    assert(contains(h));
+    return values_[slots_[h.index()].position];
+  }
+  const T& operator[](const Handle& h) const noexcept {
+    assert(contains(h));
+    return values_[slots_[h.index()].position];
+  }
+
+  /// Throws std::out_of_range if the handle does not refer to a value
+  T& at(const Handle& h) {
+    if (!contains(h)) {
+      throw std::out_of_range("slot_map: invalid handle");
+    }
+    return values_[slots_[h.index()].position];
+  }
+  const T& at(const Handle& h) const {
+    if (!contains(h)) {
+      throw std::out_of_range("slot_map: invalid handle");
+    }
+    return values_[slots_[h.index()].position];
+  }
+
+  /// Handle of the value at the given position of the dense storage
+  Handle handle_at(size_type position) const noexcept {
+    const index_type index = owners_[position];
+    return Handle{index, slots_[index].generation};
+  }
+
+  /// Calls f(handle, value) for every value
+  template <class F>
+  void for_each(F&& f) {
+    for (size_type i = 0; i < values_.size(); ++i) {
+      f(handle_at(i), values_[i]);
+    }
+  }
+  template <class F>
+  void for_each(F&& f) const {
+    for (size_type i = 0; i < values_.size(); ++i) {
+      f(handle_at(i), values_[i]);
+    }
+  }
+
+  /// Erases every value, invalidating their handles
+  void clear() noexcept {
+    for (index_type index : owners_) {
+      release(index);
+    }
+    values_.clear();
+    owners_.clear();
+  }
+
+  void reserve(size_type capacity) {
+    values_.reserve(capacity);
+    owners_.reserve(capacity);
+    slots_.reserve(capacity);
+  }
+
+  size_type size() const noexcept { return values_.size(); }
+  bool empty() const noexcept { return values_.empty(); }
+
+  T* data() noexcept { return values_.data(); }
+  const T* data() const noexcept { return values_.data(); }
+
+  iterator begin() noexcept { return values_.begin(); }
+  iterator end() noexcept { return values_.end(); }
+  const_iterator begin() const noexcept { return values_.begin(); }
+  const_iterator end() const noexcept { return values_.end(); }
+
+ private:
+  static constexpr index_type none = static_cast<index_type>(~index_type{0});
+
+  // Grows the capacity geometrically, like push_back
+  template <class Vector>
+  static void reserve_one_more(Vector& v) {
+    if (v.size() == v.capacity()) {
+      v.reserve(v.empty() ? 1 : 2 * v.size());
+    }
+  }
+
+  // Generation 0 is skipped so that the null handle is never valid
+  void release(index_type index) noexcept {
+    slot& s = slots_[index];
+    s.generation = (s.generation + 1) & Handle::generation_mask;
+    if (s.generation == 0) {
+      s.generation = 1;
+    }
+    s.position = free_;
+    free_ = index;
+  }
+
+  std::vector<T, Allocator> values_;
+  std::vector<index_type, rebind<index_type>> owners_;
+  std::vector<slot, rebind<slot>> slots_;
+  index_type free_ = none;
+};
+
+}  // namespace strong_types
+}  // namespace dpsg
+
+// Without concepts, strong types are made hashable one by one
+#ifndef __cpp_concepts
+namespace std {
+template <class Tag, unsigned IndexBits, unsigned GenerationBits>
+struct hash<::dpsg::strong_types::handle<Tag, IndexBits, GenerationBits>> {
+  std::size_t operator()(
+      const ::dpsg::strong_types::handle<Tag, IndexBits, GenerationBits>& h)
+      const {
+    return ::dpsg::strong_types::detail::hasher_of_t<
+        ::dpsg::strong_types::handle<Tag, IndexBits, GenerationBits>>{}(h.value);
+  }
+};
+}  // namespace std
+#endif
+
+#endif  // GUARD_DPSG_STRONG_TYPES_SLOT_MAP_HPP
@@ -0,0 +1,428 @@
+#ifndef GUARD_DPSG_STRONG_TYPES_SOA_VECTOR_HPP
+#define GUARD_DPSG_STRONG_TYPES_SOA_VECTOR_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <strong_types.hpp>
+
+#if __has_include(<span>) && __cplusplus > 201703L
+#include <span>
+#endif
+
+namespace dpsg {
+namespace strong_types {
+
+/// Reference to a row of a soa_vector: one reference per field, to the values
+/// at the same position in every column. Like std::vector<bool>::reference,
+/// assigning a row assigns the fields it refers to. Rows are decomposed by
+/// structured bindings into references to the fields.
+template <class... Ts>
+class soa_row {
+ public:
+  using value_type = std::tuple<std::remove_const_t<Ts>...>;
+
+  explicit soa_row(Ts&... fields) noexcept : fields_{fields...} {}
+  soa_row(const soa_row&) noexcept = default;
+
+  soa_row& operator=(const soa_row& other) {
+    fields_ = other.fields_;
+    return *this;
+  }
+  soa_row& operator=(const value_type& values) {
+    fields_ = values;
+    return *this;
+  }
+  soa_row& operator=(value_type&& values) {
+    fields_ = std::move(values);
+    return *this;
+  }
+
+  /// Copies the fields
+  operator value_type() const { return value_type{fields_}; }
+
+  template <std::size_t I>
+  std::tuple_element_t<I, std::tuple<Ts...>>& get() const noexcept {
+    return std::get<I>(fields_);
+  }
+  /// The field of type Field, which must appear once in the row
+  template <class Field>
+  auto& get() const noexcept {
+    return std::get<
+        detail::position_of<Field, std::remove_const_t<Ts>...>::value>(fields_);
+  }
+
+ private:
+  std::tuple<Ts&...> fields_;
+};
+
+/// Swaps the fields the rows refer to
+template <class... Ts>
+void swap(const soa_row<Ts...>& left, const soa_row<Ts...>& right) {
+  typename soa_row<Ts...>::value_type values = left;
+  soa_row<Ts...>{left} = right;
+  soa_row<Ts...>{right} = std::move(values);
+}
+
+namespace detail {
+// Random access iterator over the rows of a soa_vector, dereferenced to
+// soa_row proxies
+template <class Vector, class Row>
+class soa_iterator {
+ public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = typename Row::value_type;
+  using difference_type = std::ptrdiff_t;
+  using reference = Row;
+  using pointer = void;
+
+  soa_iterator() noexcept = default;
+  soa_iterator(Vector* vector, std::size_t index) noexcept
+      : vector_{vector}, index_{index} {}
+  // Iterators convert to const iterators
+  template <class V,
+            class R,
+            std::enable_if_t<std::is_convertible<V*, Vector*>::value, int> = 0>
+  soa_iterator(const soa_iterator<V, R>& other) noexcept
+      : vector_{other.vector_}, index_{other.index_} {}
+
+  Row operator*() const noexcept { return (*vector_)[index_]; }
+  Row operator[](difference_type n) const noexcept {
+    return (*vector_)[index_ + static_cast<std::size_t>(n)];
+  }
+
+  soa_iterator& operator++() noexcept {
+    ++index_;
+    return *this;
+  }
+  soa_iterator operator++(int) noexcept {
+    soa_iterator copy = *this;
+    ++index_;
+    return copy;
+  }
+  soa_iterator& operator--() noexcept {
+    --index_;
+    return *this;
+  }
+  soa_iterator operator--(int) noexcept {
+    soa_iterator copy = *this;
+    --index_;
+    return copy;
+  }
+  soa_iterator& operator+=(difference_type n) noexcept {
+    index_ += static_cast<std::size_t>(n);
+    return *this;
+  }
+  soa_iterator& operator-=(difference_type n) noexcept {
+    index_ -= static_cast<std::size_t>(n);
+    return *this;
+  }
+
+  friend soa_iterator operator+(soa_iterator it, difference_type n) noexcept {
+    return it += n;
+  }
+  friend soa_iterator operator+(difference_type n, soa_iterator it) noexcept {
+    return it += n;
+  }
+  friend soa_iterator operator-(soa_iterator it, difference_type n) noexcept {
+    return it -= n;
+  }
+  friend difference_type operator-(const soa_iterator& left,
+                                   const soa_iterator& right) noexcept {
+    return static_cast<difference_type>(left.index_) -
+           static_cast<difference_type>(right.index_);
+  }
+
+  friend bool operator==(const soa_iterator& left,
+                         const soa_iterator& right) noexcept {
+    return left.index_ == right.index_;
+  }
+  friend bool operator!=(const soa_iterator& left,
+                         const soa_iterator& right) noexcept {
+    return left.index_ != right.index_;
+  }
+  friend bool operator<(const soa_iterator& left,
+                        const soa_iterator& right) noexcept {
+    return left.index_ < right.index_;
+  }
+  friend bool operator>(const soa_iterator& left,
+                        const soa_iterator& right) noexcept {
+    return left.index_ > right.index_;
+  }
+  friend bool operator<=(const soa_iterator& left,
+                         const soa_iterator& right) noexcept {
+    return left.index_ <= right.index_;
+  }
+  friend bool operator>=(const soa_iterator& left,
+                         const soa_iterator& right) noexcept {
+    return left.index_ >= right.index_;
+  }
+
+ private:
+  template <class V, class R>
+  friend class soa_iterator;
+
+  Vector* vector_{nullptr};
+  std::size_t index_{0};
+};
+}  // namespace detail
+
+/// Records of Fields stored as a structure of arrays: the values of each field
+/// are stored contiguously in their own column, so that a loop over one field
+/// only reads that field. Columns are accessed by type (or by position) as
+/// arrays of strong types, for the bulk operations, and rows as soa_row
+/// proxies. Rows are added to every column or to none: when a column can't
+/// grow or a field can't be constructed, the fields already added are removed.
+template <class... Fields>
+class soa_vector {
+ public:
+  static_assert(sizeof...(Fields) > 0, "soa_vector expects fields");
+
+  using columns_type = std::tuple<std::vector<Fields>...>;
+  using value_type = std::tuple<Fields...>;
+  using reference = soa_row<Fields...>;
+  using const_reference = soa_row<const Fields...>;
+  using iterator = detail::soa_iterator<soa_vector, reference>;
+  using const_iterator =
+      detail::soa_iterator<const soa_vector, const_reference>;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+
+  soa_vector() = default;
+
+  /// size value-initialized rows
+  explicit soa_vector(size_type size) { resize(size); }
+
+  /// Takes columns filled elsewhere (like the columns of a csv_reader).
+  /// Throws std::invalid_argument if their sizes differ.
+  explicit soa_vector(columns_type columns) : columns_{std::move(columns)} {
+    if (!same_sizes(std::index_sequence_for<Fields...>{})) {
+      throw std::invalid_argument("soa_vector: columns of different sizes");
+    }
+  }
+
+  /// Appends a row and returns it
+  reference push_back(Fields... fields) {
+    emplace_row(std::index_sequence_for<Fields...>{}, std::move(fields)...);
+    return back();
+  }
+  reference push_back(const value_type& row) {
+    return push_back(row, std::index_sequence_for<Fields...>{});
+  }
+
+  /// Appends a row whose fields are constructed from the arguments, one per
+  /// field
+  template <class... Args>
+  reference emplace_back(Args&&... args) {
+    static_assert(sizeof...(Args) == sizeof...(Fields),
+                  "emplace_back expects one argument per field");
+    emplace_row(std::index_sequence_for<Fields...>{},
+                std::forward<Args>(args)...);
+    return back();
+  }
+
+  /// Expects a row
+  void pop_back() noexcept {
+    assert(!empty());
+    truncate(size() - 1);
+  }
+
+  void resize(size_type size) {
+    const size_type old_size = this->size();
+    try {
+      for_each_column([size](auto& column) { column.resize(size); });
+    } catch (...) {
+      truncate(std::min(size, old_size));
+      throw;
+    }
+  }
+
+  void reserve(size_type capacity) {
+    for_each_column([capacity](auto& column) { column.reserve(capacity); });
+  }
+
+  void shrink_to_fit() {
+    for_each_column([](auto& column) { column.shrink_to_fit(); });
+  }
+
+  void clear() noexcept {
+    for_each_column([](auto& column) { column.clear(); });
+  }
+
+  void swap(soa_vector& other) noexcept { columns_.swap(other.columns_); }
+
+  size_type size() const noexcept { return std::get<0>(columns_).size(); }
+  bool empty() const noexcept { return size() == 0; }
+  /// Number of rows every column holds without reallocating
+  size_type capacity() const noexcept {
+    return capacity(std::index_sequence_for<Fields...>{});
+  }
+
+  /// Expects i < size()
+  reference operator[](size_type i) noexcept {
+    assert(i < size());
+    return row<reference>(columns_, i, std::index_sequence_for<Fields...>{});
+  }
+  const_reference operator[](size_type i) const noexcept {
+    assert(i < size());
+    return row<const_reference>(columns_, i,
+                                std::index_sequence_for<Fields...>{});
+  }
+
+  /// Throws std::out_of_range if i >= size()
+  reference at(size_type i) {
+    if (i >= size()) {
+      throw std::out_of_range("soa_vector: index out of range");
+    }
+    return (*this)[i];
+  }
+  const_reference at(size_type i) const {
+    if (i >= size()) {
+      throw std::out_of_range("soa_vector: index out of range");
+    }
+    return (*this)[i];
+  }
+
+  reference front() noexcept { return (*this)[0]; }
+  const_reference front() const noexcept { return (*this)[0]; }
+  reference back() noexcept { return (*this)[size() - 1]; }
+  const_reference back() const noexcept { return (*this)[size() - 1]; }
+
+  iterator begin() noexcept { return {this, 0}; }
+  iterator end() noexcept { return {this, size()}; }
+  const_iterator begin() const noexcept { return {this, 0}; }
+  const_iterator end() const noexcept { return {this, size()}; }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  /// The values of a column, size() of them
+  template <std::size_t I>
+  auto* data() noexcept {
+    return std::get<I>(columns_).data();
+  }
+  template <std::size_t I>
+  const auto* data() const noexcept {
+    return std::get<I>(columns_).data();
+  }
+  /// The column of Field, which must appear once in Fields
+  template <class Field>
+  Field* data() noexcept {
+    return std::get<detail::position_of<Field, Fields...>::value>(columns_)
+        .data();
+  }
+  template <class Field>
+  const Field* data() const noexcept {
+    return std::get<detail::position_of<Field, Fields...>::value>(columns_)
+        .data();
+  }
+
+#ifdef __cpp_lib_span
+  template <std::size_t I>
+  auto column() noexcept {
+    return std::span{std::get<I>(columns_)};
+  }
+  template <std::size_t I>
+  auto column() const noexcept {
+    return std::span{std::get<I>(columns_)};
+  }
+  template <class Field>
+  std::span<Field> column() noexcept {
+    return {data<Field>(), size()};
+  }
+  template <class Field>
+  std::span<const Field> column() const noexcept {
+    return {data<Field>(), size()};
+  }
+#endif
+
+  /// The columns can be read, but not resized, in place
+  const columns_type& columns() const noexcept { return columns_; }
+
+ private:
+  template <class Row, class Columns, std::size_t... Is>
+  static Row row(Columns& columns,
+                 size_type i,
+                 std::index_sequence<Is...>) noexcept {
+    return Row{std::get<Is>(columns)[i]...};
+  }
+
+  template <std::size_t... Is>
+  reference push_back(const value_type& row, std::index_sequence<Is...>) {
+    return push_back(std::get<Is>(row)...);
+  }
+
+  template <class F>
+  void for_each_column(F&& f) {
+    for_each_column(f, std::index_sequence_for<Fields...>{});
+  }
+  template <class F, std::size_t... Is>
+  void for_each_column(F& f, std::index_sequence<Is...>) {
+    (void)std::initializer_list<int>{(f(std::get<Is>(columns_)), 0)...};
+  }
+
+  // When a column can't grow or a field can't be constructed, the fields
+  // already appended to the other columns are removed
+  template <std::size_t... Is, class... Args>
+  void emplace_row(std::index_sequence<Is...>, Args&&... args) {
+    const size_type old_size = size();
+    try {
+      (void)std::initializer_list<int>{
+          (std::get<Is>(columns_).emplace_back(std::forward<Args>(args)),
+           0)...};
+    } catch (...) {
+      truncate(old_size);
+      throw;
+    }
+  }
+
+  // Removes the rows after size from the columns holding them
+  void truncate(size_type size) noexcept {
+    for_each_column([size](auto& column) {
+      while (column.size() > size) {
+        column.pop_back();
+      }
+    });
+  }
+
+  template <std::size_t... Is>
+  size_type capacity(std::index_sequence<Is...>) const noexcept {
+    return std::min({std::get<Is>(columns_).capacity()...});
+  }
+
+  template <std::size_t... Is>
+  bool same_sizes(std::index_sequence<Is...>) const noexcept {
+    const size_type sizes[] = {std::get<Is>(columns_).size()...};
+    return std::all_of(std::begin(sizes), std::end(sizes),
+                       [&](size_type s) { return s == sizes[0]; });
+  }
+
+  columns_type columns_;
+};
+
+template <class... Fields>
+void swap(soa_vector<Fields...>& left, soa_vector<Fields...>& right) noexcept {
+  left.swap(right);
+}
+
+}  // namespace strong_types
+}  // namespace dpsg
+
+// Structured bindings decompose rows into their fields
+namespace std {
+template <class... Ts>
+struct tuple_size<::dpsg::strong_types::soa_row<Ts...>>
+    : integral_constant<size_t, sizeof...(Ts)> {};
+template <size_t I, class... Ts>
+struct tuple_element<I, ::dpsg::strong_types::soa_row<Ts...>>
+    : tuple_element<I, tuple<Ts...>> {};
+}  // namespace std
+
+#endif  // GUARD_DPSG_STRONG_TYPES_SOA_VECTOR_HPP
@@ -0,0 +1,133 @@
+#ifndef GUARD_DPSG_STRONG_TYPES_TRANSPARENT_HPP
+#define GUARD_DPSG_STRONG_TYPES_TRANSPARENT_HPP
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <strong_types.hpp>
+#include <strong_types/hash.hpp>
+
+#if __has_include(<string_view>) && __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+namespace dpsg {
+namespace strong_types {
+
+namespace detail {
+template <std::size_t N>
+struct rank : rank<N - 1> {};
+template <>
+struct rank<0> {};
+
+template <class T, class = void>
+struct declares_transparent : std::false_type {};
+template <class T>
+struct declares_transparent<T, void_t<typename T::is_transparent>>
+    : std::true_type {};
+
+// Integers and enumerations are converted to the value type, as the comparison
+// operators of the strong type would do.
+template <class Hasher,
+          class Value,
+          class U,
+          std::enable_if_t<(std::is_arithmetic<U>::value ||
+                            std::is_enum<U>::value) &&
+                               std::is_convertible<U, Value>::value,
+                           int> = 0>
+constexpr std::size_t hash_raw(const U& u, rank<2> /* highest priority */) {
+  return Hasher{}(static_cast<Value>(u));
+}
+
+// Transparent hashers give the same hash to equal values of different types
+template <class Hasher,
+          class Value,
+          class U,
+          std::enable_if_t<declares_transparent<Hasher>::value, int> = 0>
+constexpr auto hash_raw(const U& u, rank<1> /* priority */)
+    -> decltype(static_cast<std::size_t>(Hasher{}(u))) {
+  return Hasher{}(u);
+}
+
+#ifdef __cpp_lib_string_view
+// std::hash of a string and of a string_view of the same characters are equal
+template <class Hasher,
+          class Value,
+          class U,
+          class Char = typename Value::value_type,
+          class Traits = typename Value::traits_type,
+          std::enable_if_t<
+              std::is_same<Hasher, std::hash<Value>>::value &&
+                  std::is_same<Value,
+                               std::basic_string<Char,
+                                                 Traits,
+                                                 typename Value::allocator_type>>::
+                      value &&
+                  std::is_convertible<const U&,
+                                      std::basic_string_view<Char, Traits>>::value,
+              int> = 0>
+std::size_t hash_raw(const U& u, rank<0> /* lowest priority */) {
+  return std::hash<std::basic_string_view<Char, Traits>>{}(u);
+}
+#endif
+
+template <class Hasher, class Value, class U>
+using hash_raw_t = decltype(hash_raw<Hasher, Value>(std::declval<const U&>(),
+                                                    rank<2>{}));
+}  // namespace detail
+
+/// Hash of a hashable Strong type that can also hash the values Strong is
+/// compared with without building a Strong (integers, strings views for
+/// strings...), with the same result. Combined with a transparent equality
+/// (like transparent_equal_to), this enables heterogeneous lookup in
+/// unordered containers (C++20).
+template <class Strong>
+struct transparent_hash {
+  using is_transparent = void;
+  using hasher = detail::hasher_of_t<Strong>;
+  using value_type = typename Strong::hashable;
+
+  std::size_t operator()(const Strong& strong) const {
+    return hasher{}(get_value_t{}(strong));
+  }
+
+  template <class U,
+            std::enable_if_t<!detail::is_same_or_derived<U, Strong>::value,
+                             int> = 0,
+            class = detail::hash_raw_t<hasher, value_type, U>>
+  std::size_t operator()(const U& raw) const {
+    return detail::hash_raw<hasher, value_type>(raw, detail::rank<2>{});
+  }
+};
+
+/// Equality accepting any pair of types comparable with ==, like
+/// std::equal_to<void>. With strong types, the comparisons allowed are those
+/// of the comparable and comparable_with modifiers.
+struct transparent_equal_to {
+  using is_transparent = void;
+
+  template <class L, class R>
+  constexpr auto operator()(L&& left, R&& right) const
+      -> decltype(std::forward<L>(left) == std::forward<R>(right)) {
+    return std::forward<L>(left) == std::forward<R>(right);
+  }
+};
+
+/// Ordering accepting any pair of types comparable with <, like
+/// std::less<void>, for heterogeneous lookup in ordered containers.
+struct transparent_less {
+  using is_transparent = void;
+
+  template <class L, class R>
+  constexpr auto operator()(L&& left, R&& right) const
+      -> decltype(std::forward<L>(left) < std::forward<R>(right)) {
+    return std::forward<L>(left) < std::forward<R>(right);
+  }
+};
+
+}  // namespace strong_types
+}  // namespace dpsg
+
+#endif  // GUARD_DPSG_STRONG_TYPES_TRANSPARENT_HPP
@@ -0,0 +1,364 @@
+#ifndef GUARD_DPSG_STRONG_TYPES_WIDE_FLAG_HPP
+#define GUARD_DPSG_STRONG_TYPES_WIDE_FLAG_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <strong_types.hpp>
+#include <strong_types/bits.hpp>
+#include <strong_types/flags.hpp>
+
+#if __cplusplus >= 201703L && __has_include(<experimental/simd>)
+#if defined(__cpp_lib_is_constant_evaluated)
+#include <experimental/simd>
+#define DPSG_STRONG_TYPES_WIDE_FLAG_SIMD
+#define DPSG_STRONG_TYPES_IS_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#include <experimental/simd>
+#define DPSG_STRONG_TYPES_WIDE_FLAG_SIMD
+#define DPSG_STRONG_TYPES_IS_CONSTANT_EVALUATED() \
+  __builtin_is_constant_evaluated()
+#endif
+#endif
+#endif
+
+namespace dpsg {
+namespace strong_types {
+
+namespace detail {
+namespace wide {
+using word = std::uint64_t;
+constexpr std::size_t word_bits = 64;
+
+struct and_t {
+  template <class T>
+  constexpr T operator()(const T& left, const T& right) const noexcept {
+    return left & right;
+  }
+};
+struct or_t {
+  template <class T>
+  constexpr T operator()(const T& left, const T& right) const noexcept {
+    return left | right;
+  }
+};
+struct xor_t {
+  template <class T>
+  constexpr T operator()(const T& left, const T& right) const noexcept {
+    return left ^ right;
+  }
+};
+struct and_not_t {
+  template <class T>
+  constexpr T operator()(const T& left, const T& right) const noexcept {
+    return left & ~right;
+  }
+};
+
+// The SIMD kernels can't be evaluated in constant expressions, they are only
+// called at run time. The words left after the last full SIMD register are
+// handled by the scalar loops.
+#ifdef DPSG_STRONG_TYPES_WIDE_FLAG_SIMD
+namespace stdx = std::experimental;
+using simd_t = stdx::native_simd<word>;
+constexpr std::size_t simd_words = simd_t::size();
+
+inline simd_t load(const word* first) noexcept {
+  return simd_t(first, stdx::element_aligned);
+}
+
+template <class Op>
+std::size_t simd_transform(const word* left,
+                           const word* right,
+                           word* out,
+                           std::size_t size) noexcept {
+  std::size_t i = 0;
+  for (; i + simd_words <= size; i += simd_words) {
+    Op{}(load(left + i), load(right + i)).copy_to(out + i, stdx::element_aligned);
+  }
+  return i;
+}
+
+// Index of the first full register where left & ~right has a bit set, or
+// the number of words covered by full registers if there is none
+inline std::size_t simd_find_and_not(const word* left,
+                                     const word* right,
+                                     std::size_t size) noexcept {
+  std::size_t i = 0;
+  for (; i + simd_words <= size; i += simd_words) {
+    if (stdx::any_of((load(left + i) & ~load(right + i)) != 0)) {
+      return i;
+    }
+  }
+  return i;
+}
+#endif
+
+template <class Op>
+constexpr void transform(const word* left,
+                         const word* right,
+                         word* out,
+                         std::size_t size) noexcept {
+  std::size_t i = 0;
+#ifdef DPSG_STRONG_TYPES_WIDE_FLAG_SIMD
+  if (!DPSG_STRONG_TYPES_IS_CONSTANT_EVALUATED()) {
+    i = simd_transform<Op>(left, right, out, size);
+  }
+#endif
+  for (; i < size; ++i) {
+    out[i] = Op{}(left[i], right[i]);
+  }
+}
+
+// True if every bit of right is set in left
+constexpr bool includes(const word* left,
+                        const word* right,
+                        std::size_t size) noexcept {
+  std::size_t i = 0;
+#ifdef DPSG_STRONG_TYPES_WIDE_FLAG_SIMD
+  if (!DPSG_STRONG_TYPES_IS_CONSTANT_EVALUATED()) {
+    i = simd_find_and_not(right, left, size);
+  }
+#endif
+  for (; i < size; ++i) {
+    if ((right[i] & ~left[i]) != 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+constexpr bool intersects(const word* left,
+                          const word* right,
+                          std::size_t size) noexcept {
+  for (std::size_t i = 0; i < size; ++i) {
+    if ((left[i] & right[i]) != 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// popcnt on each word is as fast as the SIMD population counts available
+// before AVX-512
+constexpr std::size_t count(const word* words, std::size_t size) noexcept {
+  std::size_t result = 0;
+  for (std::size_t i = 0; i < size; ++i) {
+    result += popcount(words[i]);
+  }
+  return result;
+}
+
+constexpr bool any(const word* words, std::size_t size) noexcept {
+  word result = 0;
+  for (std::size_t i = 0; i < size; ++i) {
+    result |= words[i];
+  }
+  return result != 0;
+}
+
+constexpr bool equal(const word* left,
+                     const word* right,
+                     std::size_t size) noexcept {
+  word difference = 0;
+  for (std::size_t i = 0; i < size; ++i) {
+    difference |= left[i] ^ right[i];
+  }
+  return difference == 0;
+}
+}  // namespace wide
+}  // namespace detail
+
+/// Set of up to N flags, where the enumerators of Enum are the positions of
+/// the flags (from 0 to N - 1) rather than masks. The flags are stored in an
+/// array of 64 bit words, and provide the bitwise operators of flag, with
+/// each other and with Enum. The operations over every word use SIMD
+/// registers when std::experimental::simd is available.
+template <class Enum, std::size_t N>
+class wide_flag {
+  static_assert(std::is_enum<Enum>::value,
+                "Underlying type for wide_flag must be an enum");
+  static_assert(N > 0, "wide_flag must hold at least one flag");
+
+  using word = detail::wide::word;
+  static constexpr std::size_t word_bits = detail::wide::word_bits;
+
+ public:
+  using value_type = Enum;
+  static constexpr std::size_t size = N;
+  static constexpr std::size_t word_count = (N + word_bits - 1) / word_bits;
+
+  constexpr wide_flag() noexcept = default;
+  constexpr explicit wide_flag(Enum e) noexcept { set(e); }
+
+  /// Index of the flag of an enumerator, which must be less than N
+  static constexpr std::size_t index_of(Enum e) noexcept {
+    return static_cast<std::size_t>(e);
+  }
+
+  constexpr bool test(Enum e) const noexcept {
+    assert(index_of(e) < N);
+    return (words_[index_of(e) / word_bits] & mask(e)) != 0;
+  }
+  constexpr wide_flag& set(Enum e) noexcept {
+    assert(index_of(e) < N);
+    words_[index_of(e) / word_bits] |= mask(e);
+    return *this;
+  }
+  constexpr wide_flag& reset(Enum e) noexcept {
+    assert(index_of(e) < N);
+    words_[index_of(e) / word_bits] &= ~mask(e);
+    return *this;
+  }
+  /// Resets every flag set in other, in a single pass
+  constexpr wide_flag& reset(const wide_flag& other) noexcept {
+    detail::wide::transform<detail::wide::and_not_t>(words_, other.words_,
+                                                     words_, word_count);
+    return *this;
+  }
+
+  constexpr const std::uint64_t* words() const noexcept { return words_; }
+
+#define DPSG_STRONG_TYPES_WIDE_FLAG_OPERATOR(op, kernel)                     \
+  constexpr wide_flag& operator op##=(const wide_flag& other) noexcept {     \
+    detail::wide::transform<detail::wide::kernel>(words_, other.words_,      \
+                                                  words_, word_count);       \
+    return *this;                                                            \
+  }                                                                          \
+  constexpr friend wide_flag operator op(const wide_flag& left,              \
+                                         const wide_flag& right) noexcept {  \
+    wide_flag result;                                                        \
+    detail::wide::transform<detail::wide::kernel>(                           \
+        left.words_, right.words_, result.words_, word_count);               \
+    return result;                                                           \
+  }                                                                          \
+  constexpr wide_flag& operator op##=(Enum other) noexcept {                 \
+    return *this op## = wide_flag{other};                                    \
+  }                                                                          \
+  constexpr friend wide_flag operator op(const wide_flag& left,              \
+                                         Enum right) noexcept {              \
+    return left op wide_flag{right};                                         \
+  }                                                                          \
+  constexpr friend wide_flag operator op(Enum left,                          \
+                                         const wide_flag& right) noexcept {  \
+    return wide_flag{left} op right;                                         \
+  }
+  DPSG_STRONG_TYPES_WIDE_FLAG_OPERATOR(&, and_t)
+  DPSG_STRONG_TYPES_WIDE_FLAG_OPERATOR(|, or_t)
+  DPSG_STRONG_TYPES_WIDE_FLAG_OPERATOR(^, xor_t)
+#undef DPSG_STRONG_TYPES_WIDE_FLAG_OPERATOR
+
+  constexpr wide_flag operator~() const noexcept {
+    wide_flag result;
+    for (std::size_t i = 0; i < word_count; ++i) {
+      result.words_[i] = ~words_[i];
+    }
+    result.words_[word_count - 1] &= last_word_mask;
+    return result;
+  }
+
+  constexpr friend bool operator==(const wide_flag& left,
+                                   const wide_flag& right) noexcept {
+    return detail::wide::equal(left.words_, right.words_, word_count);
+  }
+  constexpr friend bool operator!=(const wide_flag& left,
+                                   const wide_flag& right) noexcept {
+    return !(left == right);
+  }
+  constexpr friend bool operator==(const wide_flag& left, Enum right) noexcept {
+    return left == wide_flag{right};
+  }
+  constexpr friend bool operator!=(const wide_flag& left, Enum right) noexcept {
+    return !(left == right);
+  }
+  constexpr friend bool operator==(Enum left, const wide_flag& right) noexcept {
+    return wide_flag{left} == right;
+  }
+  constexpr friend bool operator!=(Enum left, const wide_flag& right) noexcept {
+    return !(left == right);
+  }
+
+ private:
+  static constexpr word last_word_mask =
+      N % word_bits == 0 ? ~word{0} : (word{1} << (N % word_bits)) - 1;
+
+  static constexpr word mask(Enum e) noexcept {
+    return word{1} << (index_of(e) % word_bits);
+  }
+
+  alignas(word_count * sizeof(word) >= 32 ? 32 : sizeof(word))
+      word words_[word_count]{};
+};
+
+/// left & ~right, without building ~right
+template <class Enum, std::size_t N>
+constexpr wide_flag<Enum, N> and_not(const wide_flag<Enum, N>& left,
+                                     const wide_flag<Enum, N>& right) noexcept {
+  wide_flag<Enum, N> result{left};
+  result.reset(right);
+  return result;
+}
+
+/// Number of flags set
+template <class Enum, std::size_t N>
+constexpr std::size_t count(const wide_flag<Enum, N>& flags) noexcept {
+  return detail::wide::count(flags.words(), wide_flag<Enum, N>::word_count);
+}
+
+template <class Enum, std::size_t N>
+constexpr bool any(const wide_flag<Enum, N>& flags) noexcept {
+  return detail::wide::any(flags.words(), wide_flag<Enum, N>::word_count);
+}
+
+template <class Enum, std::size_t N>
+constexpr bool none(const wide_flag<Enum, N>& flags) noexcept {
+  return !detail::wide::any(flags.words(), wide_flag<Enum, N>::word_count);
+}
+
+/// True if every flag of the mask is set in flags
+template <class Enum, std::size_t N>
+constexpr bool all_of(const wide_flag<Enum, N>& flags,
+                      const wide_flag<Enum, N>& mask) noexcept {
+  return detail::wide::includes(flags.words(), mask.words(),
+                                wide_flag<Enum, N>::word_count);
+}
+template <class Enum, std::size_t N>
+constexpr bool all_of(const wide_flag<Enum, N>& flags, Enum mask) noexcept {
+  return flags.test(mask);
+}
+
+/// True if at least one flag of the mask is set in flags
+template <class Enum, std::size_t N>
+constexpr bool any_of(const wide_flag<Enum, N>& flags,
+                      const wide_flag<Enum, N>& mask) noexcept {
+  return detail::wide::intersects(flags.words(), mask.words(),
+                                  wide_flag<Enum, N>::word_count);
+}
+template <class Enum, std::size_t N>
+constexpr bool any_of(const wide_flag<Enum, N>& flags, Enum mask) noexcept {
+  return flags.test(mask);
+}
+
+/// Calls f with the enumerator of each flag set, in increasing order
+template <class Enum, std::size_t N, class F>
+constexpr void for_each_set_bit(const wide_flag<Enum, N>& flags, F&& f) {
+  const std::uint64_t* words = flags.words();
+  for (std::size_t i = 0; i < wide_flag<Enum, N>::word_count; ++i) {
+    for (std::uint64_t w = words[i]; w != 0; w &= w - 1) {
+      f(static_cast<Enum>(
+          i * detail::wide::word_bits +
+          static_cast<std::size_t>(detail::count_trailing_zeros(w))));
+    }
+  }
+}
+
+}  // namespace strong_types
+}  // namespace dpsg
+
+#undef DPSG_STRONG_TYPES_IS_CONSTANT_EVALUATED
+#undef DPSG_STRONG_TYPES_WIDE_FLAG_SIMD
+
+#endif  // GUARD_DPSG_STRONG_TYPES_WIDE_FLAG_HPP
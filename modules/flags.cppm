@@ -0,0 +1,30 @@
+module;
+
+#include <strong_types/flags.hpp>
+
+export module strong_types:flags;
+
+export namespace dpsg::strong_types {
+using strong_types::non_assigning_bitwise_operators;
+using strong_types::self_assigning_bitwise_operators;
+
+using strong_types::access_value_as_ref;
+using strong_types::underlying_value_ref;
+using strong_types::return_left_argument;
+
+using strong_types::bitwise_compatible_with_enum;
+using strong_types::bitwise_enum;
+using strong_types::flag;
+using strong_types::flag_derivation;
+
+using strong_types::all_of;
+using strong_types::any;
+using strong_types::any_of;
+using strong_types::count;
+using strong_types::declared_flags;
+using strong_types::enumerators;
+using strong_types::for_each_set_bit;
+using strong_types::none;
+using strong_types::set_bit_range;
+using strong_types::set_bits;
+}  // namespace dpsg::strong_types
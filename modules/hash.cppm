@@ -0,0 +1,16 @@
+module;
+
+#include <strong_types/hash.hpp>
+
+export module strong_types:hash;
+
+export namespace dpsg::strong_types {
+using strong_types::fibonacci_hash;
+using strong_types::Hashable;
+using strong_types::hashable;
+using strong_types::hashable_with;
+using strong_types::is_hashable;
+using strong_types::is_hashable_v;
+using strong_types::mix_hash;
+using strong_types::wy_hash;
+}  // namespace dpsg::strong_types
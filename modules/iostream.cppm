@@ -0,0 +1,19 @@
+module;
+
+#include <strong_types/iostream.hpp>
+
+export module strong_types:iostream;
+
+export namespace dpsg::strong_types {
+using strong_types::basic_streamable;
+using strong_types::streamable;
+using strong_types::wstreamable;
+
+using strong_types::basic_streamable_transform;
+using strong_types::streamable_transform;
+using strong_types::wstreamable_transform;
+
+using strong_types::basic_streamable_as;
+using strong_types::streamable_as;
+using strong_types::wstreamable_as;
+}  // namespace dpsg::strong_types
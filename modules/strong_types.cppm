@@ -0,0 +1,96 @@
+// Primary module interface of strong_types. The declarations come from the
+// headers, included in the global module fragment, and are exported with using
+// declarations so that the headers remain the single source of truth.
+module;
+
+#include <strong_types.hpp>
+
+export module strong_types;
+
+export import :flags;
+export import :hash;
+export import :iostream;
+
+#define DPSG_EXPORT_OPERATOR_NAME(name, sym) using strong_types::name;
+#define DPSG_EXPORT_OPERATOR(name, sym) using detail::operator sym;
+
+export namespace dpsg::strong_types {
+using strong_types::has_value;
+using strong_types::has_value_v;
+
+using strong_types::cast_to_then_construct_t;
+using strong_types::construct_t;
+using strong_types::get_value_t;
+using strong_types::get_value_then_cast_t;
+using strong_types::passthrough_t;
+
+namespace black_magic {
+using black_magic::apply;
+using black_magic::concat_tuples;
+using black_magic::concat_tuples_t;
+using black_magic::deduce;
+using black_magic::deduce_return_type;
+using black_magic::for_each;
+using black_magic::tuple;
+}  // namespace black_magic
+
+DPSG_APPLY_TO_BINARY_OPERATORS(DPSG_EXPORT_OPERATOR_NAME)
+DPSG_APPLY_TO_SELF_ASSIGNING_BINARY_OPERATORS(DPSG_EXPORT_OPERATOR_NAME)
+DPSG_APPLY_TO_UNARY_OPERATORS(DPSG_EXPORT_OPERATOR_NAME)
+using strong_types::post_decrement;
+using strong_types::post_increment;
+
+// The operators are found by argument dependent lookup in the namespace of the
+// operation sets, they must be reachable from the importers.
+namespace detail {
+DPSG_APPLY_TO_BINARY_OPERATORS(DPSG_EXPORT_OPERATOR)
+DPSG_APPLY_TO_SELF_ASSIGNING_BINARY_OPERATORS(DPSG_EXPORT_OPERATOR)
+DPSG_APPLY_TO_UNARY_OPERATORS(DPSG_EXPORT_OPERATOR)
+}  // namespace detail
+
+using strong_types::implement_binary_operation;
+using strong_types::implement_binary_operations;
+using strong_types::implement_commutative_operation;
+using strong_types::implement_commutative_operations;
+using strong_types::implement_symmetric_operation;
+using strong_types::implement_unary_operation;
+using strong_types::implement_unary_operations;
+
+using strong_types::arithmetic_operators;
+using strong_types::binary_arithmetic_operators;
+using strong_types::binary_bitwise_operators;
+using strong_types::binary_boolean_operators;
+using strong_types::bitwise_operators;
+using strong_types::boolean_operators;
+using strong_types::comparison_operators;
+using strong_types::unary_arithmetic_operators;
+using strong_types::unary_bitwise_operators;
+using strong_types::unary_boolean_operators;
+
+using strong_types::make_binary_operator;
+using strong_types::make_commutative_operator;
+using strong_types::make_symmetric_operator;
+using strong_types::make_unary_operator;
+
+using strong_types::arithmetic;
+using strong_types::arithmetically_compatible_with;
+using strong_types::bitwise;
+using strong_types::bitwise_compatible_with;
+using strong_types::comparable;
+using strong_types::comparable_with;
+using strong_types::commutative_under;
+using strong_types::compatible_under;
+using strong_types::symmetric;
+
+using strong_types::derive_t;
+using strong_types::in_place;
+using strong_types::in_place_t;
+using strong_types::number;
+using strong_types::strong_value;
+
+using strong_types::is_layout_compatible_with_value;
+using strong_types::is_layout_compatible_with_value_v;
+}  // namespace dpsg::strong_types
+
+#undef DPSG_EXPORT_OPERATOR
+#undef DPSG_EXPORT_OPERATOR_NAME
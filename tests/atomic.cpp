@@ -0,0 +1,241 @@
+#include <gtest/gtest.h>
+
+#include <strong_types/atomic.hpp>
+#include <strong_types/flags.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace st = dpsg::strong_types;
+
+namespace {
+enum class status : std::uint8_t {
+  none = 0,
+  connected = 1,
+  reading = 2,
+  writing = 4,
+  closing = 8,
+};
+using status_flags = st::flag<status, struct status_tag>;
+using atomic_status = st::atomic_flag_set<status, struct status_tag>;
+
+template <class T, class M, class = void>
+struct accepts_mask : std::false_type {};
+template <class T, class M>
+struct accepts_mask<T,
+                    M,
+                    st::detail::void_t<decltype(std::declval<T&>().fetch_or(
+                        std::declval<M>()))>> : std::true_type {};
+}  // namespace
+
+TEST(AtomicFlagSet, Operations) {
+  static_assert(accepts_mask<atomic_status, status>::value, "");
+  static_assert(accepts_mask<atomic_status, status_flags>::value, "");
+  static_assert(
+      !accepts_mask<atomic_status, st::flag<status, struct other_tag>>::value,
+      "flags of another tag are rejected");
+  static_assert(!accepts_mask<atomic_status, int>::value, "");
+
+  atomic_status s{status::connected};
+  ASSERT_EQ(s.load(), status::connected);
+  ASSERT_EQ(s.fetch_or(status::reading), status::connected);
+  ASSERT_EQ(s.fetch_or(status_flags{status::writing},
+                       std::memory_order_relaxed),
+            status_flags{status::connected} | status::reading);
+  ASSERT_EQ(s.fetch_and(~status_flags{status::reading},
+                        std::memory_order_acq_rel),
+            status_flags{status::connected} | status::reading |
+                status::writing);
+  ASSERT_EQ(s.fetch_xor(status::connected),
+            status_flags{status::connected} | status::writing);
+  ASSERT_EQ(s.load(std::memory_order_acquire), status::writing);
+
+  ASSERT_EQ(s |= status::closing,
+            status_flags{status::writing} | status::closing);
+  ASSERT_EQ(s &= status::closing, status::closing);
+  ASSERT_EQ(s ^= status::closing, status::none);
+
+  ASSERT_FALSE(s.test_and_set(status::closing));
+  ASSERT_TRUE(s.test_and_set(status::closing));
+  ASSERT_TRUE(s.test(status::closing));
+  ASSERT_TRUE(s.test_and_reset(status::closing));
+  ASSERT_FALSE(s.test_and_reset(status::closing));
+  ASSERT_FALSE(s.test(status::closing));
+
+  s.store(status::reading, std::memory_order_release);
+  ASSERT_EQ(s.exchange(status::writing), status::reading);
+
+  status_flags expected{status::reading};
+  ASSERT_FALSE(s.compare_exchange_strong(expected, status::closing));
+  ASSERT_EQ(expected, status::writing);
+  ASSERT_TRUE(s.compare_exchange_strong(expected, status::closing,
+                                        std::memory_order_acq_rel,
+                                        std::memory_order_acquire));
+  ASSERT_EQ(s.load(), status::closing);
+  while (!s.compare_exchange_weak(expected, status::none,
+                                  std::memory_order_release)) {
+  }
+  ASSERT_EQ(s.load(), status::none);
+}
+
+TEST(AtomicFlagSet, Threads) {
+  atomic_status s;
+  std::atomic<int> winners{0};
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&, t] {
+      const auto mine = static_cast<status>(1 << t);
+      for (int i = 0; i < 1000; ++i) {
+        s.fetch_or(mine, std::memory_order_relaxed);
+        s.fetch_and(~status_flags{mine}, std::memory_order_relaxed);
+      }
+      s |= mine;
+      if (!s.test_and_set(status::closing)) {
+        ++winners;
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(s.load(), status_flags{status::connected} | status::reading |
+                          status::writing | status::closing);
+  ASSERT_EQ(winners, 1);
+}
+
+namespace {
+using sequence = st::number<std::uint64_t, struct sequence_tag>;
+using atomic_sequence = st::atomic_number<std::uint64_t, struct sequence_tag>;
+
+using kilobytes = st::number<std::uint32_t, struct kilobytes_tag>;
+struct kilobytes_to_bytes {
+  constexpr std::uint64_t operator()(const kilobytes& k) const noexcept {
+    return std::uint64_t{k.value} * 1024;
+  }
+};
+using bytes_compatibility =
+    st::arithmetically_compatible_with<kilobytes,
+                                       st::black_magic::deduce,
+                                       st::get_value_t,
+                                       kilobytes_to_bytes>;
+using bytes =
+    st::number<std::uint64_t, struct bytes_tag, bytes_compatibility>;
+using atomic_bytes =
+    st::atomic_number<std::uint64_t, struct bytes_tag, bytes_compatibility>;
+
+using ratio = st::number<double, struct ratio_tag>;
+using atomic_ratio = st::atomic_number<double, struct ratio_tag>;
+
+template <class T, class U, class = void>
+struct accepts_delta : std::false_type {};
+template <class T, class U>
+struct accepts_delta<T,
+                     U,
+                     st::detail::void_t<decltype(std::declval<T&>().fetch_add(
+                         std::declval<U>()))>> : std::true_type {};
+}  // namespace
+
+TEST(AtomicNumber, Operations) {
+  static_assert(accepts_delta<atomic_sequence, sequence>::value, "");
+  static_assert(accepts_delta<atomic_sequence, std::uint64_t>::value, "");
+  static_assert(!accepts_delta<atomic_sequence, bytes>::value,
+                "numbers of another tag are rejected");
+  static_assert(accepts_delta<atomic_bytes, kilobytes>::value, "");
+  static_assert(!accepts_delta<atomic_sequence, kilobytes>::value, "");
+
+  atomic_sequence s{sequence{41u}};
+  static_assert(std::is_same<decltype(s.fetch_add(1u)), sequence>::value, "");
+  ASSERT_EQ(s.fetch_add(sequence{1u}, std::memory_order_relaxed), 41u);
+  ASSERT_EQ(s.load(), 42u);
+  ASSERT_EQ(s.fetch_sub(2u), 42u);
+  ASSERT_EQ(s += 10u, 50u);
+  ASSERT_EQ(s -= sequence{8u}, 42u);
+  ASSERT_EQ(++s, 43u);
+  ASSERT_EQ(s++, 43u);
+  ASSERT_EQ(--s, 43u);
+  ASSERT_EQ(s--, 43u);
+  ASSERT_EQ(s.exchange(sequence{0u}), 42u);
+  ASSERT_EQ(s.fetch_sub(1u), 0u);
+  ASSERT_EQ(s.load(), sequence{~std::uint64_t{0}});
+
+  sequence expected{1u};
+  ASSERT_FALSE(s.compare_exchange_strong(expected, sequence{7u}));
+  ASSERT_EQ(expected, ~std::uint64_t{0});
+  ASSERT_TRUE(s.compare_exchange_strong(expected, sequence{7u},
+                                        std::memory_order_acq_rel,
+                                        std::memory_order_acquire));
+  while (!s.compare_exchange_weak(expected, sequence{8u})) {
+  }
+  s.store(sequence{3u}, std::memory_order_release);
+  ASSERT_EQ(s.load(std::memory_order_acquire), 3u);
+}
+
+TEST(AtomicNumber, CompatibleOperands) {
+  // The transformation of the operand is applied before the atomic addition
+  atomic_bytes b;
+  ASSERT_EQ(b.fetch_add(kilobytes{2u}), 0u);
+  ASSERT_EQ(b.load(), 2048u);
+  ASSERT_EQ(b += bytes{1u}, 2049u);
+  ASSERT_EQ(b.fetch_sub(kilobytes{1u}), 2049u);
+  ASSERT_EQ(b.load(), 1025u);
+
+  // Floating point numbers go through a compare-exchange loop
+  atomic_ratio r{ratio{0.5}};
+  ASSERT_EQ(r.fetch_add(0.25), 0.5);
+  ASSERT_EQ(r -= ratio{0.125}, 0.625);
+}
+
+TEST(AtomicNumber, Threads) {
+  atomic_sequence s;
+  atomic_ratio r;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 10000; ++i) {
+        s.fetch_add(1u, std::memory_order_relaxed);
+        r.fetch_add(1., std::memory_order_relaxed);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(s.load(), 40000u);
+  ASSERT_EQ(r.load(), 40000.);
+}
+
+TEST(ShardedCounter, Threads) {
+  using counter = st::sharded_counter<sequence, 4>;
+  static_assert(alignof(counter) == st::cache_line_size, "");
+  static_assert(sizeof(counter) == 4 * st::cache_line_size,
+                "each shard has its own cache line");
+
+  counter c;
+  c.add(sequence{5u});
+  c.add(2u);
+  c.subtract(1u);
+  ASSERT_EQ(c.load(), 6u);
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 6; ++t) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < 10000; ++i) {
+        c.add(1u);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  static_assert(std::is_same<decltype(c.load()), sequence>::value, "");
+  ASSERT_EQ(c.load(), 60006u);
+  ASSERT_EQ(c.reset(), 60006u);
+  ASSERT_EQ(c.load(), 0u);
+
+  st::sharded_counter<bytes> b;
+  b.add(kilobytes{1u});
+  ASSERT_EQ(b.load(), 1024u);
+}
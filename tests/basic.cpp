@@ -1,7 +1,10 @@
 #include <gtest/gtest.h>
+#include <cstdint>
 #include <random>
+#include <string>
 #include <strong_types.hpp>
 #include <type_traits>
+#include <utility>
 
 namespace st = dpsg::strong_types;
 
@@ -92,3 +95,147 @@ TEST(Basic, Addition) {
     ASSERT_EQ(n1 + n3, n3 + n1);
   }
 }
+
+TEST(Basic, PostIncrement) {
+  n n1{1};
+  ASSERT_EQ(n1++, 1);
+  ASSERT_EQ(n1, 2);
+  ASSERT_EQ(n1--, 2);
+  ASSERT_EQ(n1, 1);
+}
+
+struct bits : st::strong_value<unsigned, struct bits_tag, st::bitwise> {
+  using strong_value::strong_value;
+};
+
+TEST(Basic, Bitwise) {
+  constexpr bits b1{0b1100u}, b2{0b1010u};
+  static_assert((b1 & b2).value == 0b1000u, "");
+  static_assert((b1 | b2).value == 0b1110u, "");
+  static_assert((b1 ^ b2).value == 0b0110u, "");
+  static_assert((~b1).value == ~0b1100u, "");
+
+  bits b3{b1};
+  b3 &= b2;
+  ASSERT_EQ(b3.value, 0b1000u);
+}
+
+using wide = st::number<int, struct wide_tag, st::comparable_with<long long>>;
+
+TEST(Basic, ImplicitConversions) {
+  constexpr wide w{2};
+  // Conversions select the closest compatible type, as with plain overloads
+  static_assert(w == short{2}, "");
+  static_assert(w == 2LL, "");
+  static_assert(short{2} == w, "");
+  static_assert(w + 1.5 == 3, "");
+}
+
+struct derived_n : n {
+  using n::n;
+};
+
+TEST(Basic, DerivedOperands) {
+  constexpr derived_n d{2};
+  constexpr n n1{3};
+  static_assert(d + n1 == 5, "");
+  static_assert(n1 - d == 1, "");
+  static_assert(d < n1, "");
+}
+
+TEST(Basic, OperationSets) {
+  struct point
+      : st::implement_binary_operations<
+            st::black_magic::tuple<st::plus, st::minus, st::plus_assign>,
+            point,
+            point,
+            st::construct_t<point>> {
+    constexpr explicit point(int v) noexcept : value{v} {}
+    int value;
+  };
+
+  constexpr point p1{3}, p2{1};
+  static_assert((p1 + p2).value == 4, "");
+  static_assert((p1 - p2).value == 2, "");
+  point p3{p1};
+  p3 += p2;
+  ASSERT_EQ(p3.value, 4);
+}
+
+namespace {
+// Counts the copies of its value, which operations on temporaries reuse
+struct text {
+  static int copies;
+
+  std::string characters;
+
+  text() = default;
+  text(std::size_t count, char c) : characters(count, c) {}
+  text(const text& other) : characters{other.characters} { ++copies; }
+  text(text&&) noexcept = default;
+  text& operator=(const text&) = default;
+  text& operator=(text&&) noexcept = default;
+
+  text& operator+=(const text& other) {
+    characters += other.characters;
+    return *this;
+  }
+  friend text operator+(const text& left, const text& right) {
+    text result{left};
+    result.characters += right.characters;
+    return result;
+  }
+  friend text operator+(text&& left, const text& right) {
+    left.characters += right.characters;
+    return std::move(left);
+  }
+};
+int text::copies = 0;
+
+using message = st::strong_value<text, struct message_tag, st::arithmetic>;
+}  // namespace
+
+TEST(Basic, RvalueOperands) {
+  const message separator{st::in_place, 1, ' '};
+  message log{st::in_place, 3, 'a'};
+  text::copies = 0;
+
+  message line = std::move(log) + separator + separator;
+  ASSERT_EQ(line.value.characters, "aaa  ");
+  ASSERT_EQ(text::copies, 0);
+
+  line += message{st::in_place, 2, 'b'};
+  ASSERT_EQ(line.value.characters, "aaa  bb");
+  ASSERT_EQ(text::copies, 0);
+
+  message copy = line + separator;
+  ASSERT_EQ(copy.value.characters, "aaa  bb ");
+  ASSERT_EQ(text::copies, 1);
+}
+
+namespace {
+using symbol =
+    st::strong_value<std::string,
+                     struct symbol_tag,
+                     st::symmetric<st::plus_assign>,
+                     st::compatible_under<st::plus_assign, std::string>>;
+using total =
+    st::strong_value<std::uint64_t,
+                     struct total_tag,
+                     st::compatible_under<st::plus_assign, std::uint64_t>>;
+}  // namespace
+
+TEST(Basic, ConvertedAssignmentOperands) {
+  // The operands are converted to a temporary std::string and std::uint64_t,
+  // which must outlive the operation
+  symbol s{std::string{"prefix"}};
+  s += "_followed_by_a_literal_too_long_for_the_small_string_buffer";
+  ASSERT_EQ(s.value,
+            "prefix_followed_by_a_literal_too_long_for_the_small_string_buffer");
+  s += symbol{std::string{"!"}};
+  ASSERT_EQ(s.value.back(), '!');
+
+  total t{40u};
+  t += 2u;
+  ASSERT_EQ(t.value, 42u);
+}
@@ -0,0 +1,160 @@
+#include <gtest/gtest.h>
+
+#include <strong_types/binary.hpp>
+#include <strong_types/flags.hpp>
+
+// std::byte requires C++17
+#ifdef __cpp_lib_byte
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace st = dpsg::strong_types;
+
+namespace {
+enum class side : std::uint8_t { bid = 1, ask = 2 };
+enum class status : std::uint16_t { open = 1, halted = 2, closed = 4 };
+
+using order_id = st::strong_value<std::uint64_t,
+                                  struct order_id_tag,
+                                  st::serializable<st::endianness::big>>;
+using price = st::number<double,
+                         struct price_tag,
+                         st::serializable<st::endianness::little>>;
+using quantity = st::number<std::uint32_t,
+                            struct quantity_tag,
+                            st::serializable<st::endianness::big>>;
+using statuses = st::flag<status,
+                          struct status_tag,
+                          st::serializable<st::endianness::big>>;
+// Not layout compatible with its value
+using padded = st::number<std::uint16_t,
+                          struct padded_tag,
+                          st::serializable<st::endianness::big>,
+                          st::cacheline_aligned>;
+}  // namespace
+
+TEST(Binary, WriteRead) {
+  static_assert(st::serialized_size<order_id> == 8, "");
+  static_assert(st::serialized_size<statuses> == 2, "");
+  static_assert(st::serialized_size<side> == 1, "");
+  static_assert(!st::detail::binary::is_wire_value<bool>::value,
+                "decoding a byte other than 0 or 1 would make an invalid bool");
+
+  std::array<std::byte, 32> buffer{};
+  std::byte* out = buffer.data();
+  out = st::write(out, order_id{0x0102030405060708u});
+  out = st::write(out, quantity{0x0A0B0C0Du});
+  out = st::write(out, statuses{status::open} | status::closed);
+  out = st::write<st::endianness::little>(out, std::uint16_t{0x1122});
+  out = st::write<st::endianness::big>(out, side::ask);
+  ASSERT_EQ(out - buffer.data(), 8 + 4 + 2 + 2 + 1);
+
+  const unsigned char expected[] = {1, 2,  3,  4,  5,  6,  7,    8,   10,
+                                    11, 12, 13, 0, 5, 0x22, 0x11, 2};
+  for (std::size_t i = 0; i < sizeof expected; ++i) {
+    ASSERT_EQ(buffer[i], static_cast<std::byte>(expected[i])) << i;
+  }
+
+  const std::byte* in = buffer.data();
+  order_id id;
+  quantity q;
+  statuses s;
+  std::uint16_t raw = 0;
+  side sd = side::bid;
+  in = st::read(in, id);
+  in = st::read(in, q);
+  in = st::read(in, s);
+  in = st::read<st::endianness::little>(in, raw);
+  in = st::read<st::endianness::big>(in, sd);
+  ASSERT_EQ(in, out);
+  ASSERT_EQ(id.value, 0x0102030405060708u);
+  ASSERT_EQ(q, quantity{0x0A0B0C0Du});
+  ASSERT_EQ(s, statuses{status::open} | status::closed);
+  ASSERT_EQ(raw, 0x1122);
+  ASSERT_EQ(sd, side::ask);
+
+  // Floating point values are written as their bits
+  out = st::write(buffer.data(), price{-2.5});
+  price p;
+  ASSERT_EQ(st::read(buffer.data(), p), out);
+  ASSERT_EQ(p, -2.5);
+  const std::byte* end =
+      st::write<st::endianness::big>(buffer.data(), price{1e300});
+  ASSERT_EQ(st::read<st::endianness::big>(buffer.data(), p), end);
+  ASSERT_EQ(p, 1e300);
+}
+
+TEST(Binary, EncodeDecode) {
+  std::vector<quantity> quantities;
+  std::vector<price> prices;
+  std::vector<padded> padded_values(5);
+  for (std::uint32_t i = 0; i < 37; ++i) {
+    quantities.emplace_back(i * 0x01010101u);
+    prices.emplace_back(i * 0.25);
+  }
+  for (std::uint16_t i = 0; i < 5; ++i) {
+    padded_values[i].value = static_cast<std::uint16_t>(0x0100 + i);
+  }
+
+  std::vector<std::byte> buffer(37 * 4 + 37 * 8 + 5 * 2);
+  std::byte* out = buffer.data();
+  out = st::encode(quantities.data(), quantities.size(), out);
+  out = st::encode(prices.data(), prices.size(), out);
+  out = st::encode(padded_values.data(), padded_values.size(), out);
+  ASSERT_EQ(out, buffer.data() + buffer.size());
+
+  // Same bytes as writing the values one by one
+  std::vector<std::byte> expected(buffer.size());
+  std::byte* e = expected.data();
+  for (const auto& q : quantities) {
+    e = st::write(e, q);
+  }
+  for (const auto& p : prices) {
+    e = st::write(e, p);
+  }
+  for (const auto& v : padded_values) {
+    e = st::write(e, v);
+  }
+  ASSERT_EQ(buffer, expected);
+  ASSERT_EQ(buffer[37 * 4 + 37 * 8], std::byte{1});
+
+  std::vector<quantity> decoded_quantities(37);
+  std::vector<price> decoded_prices(37);
+  std::vector<padded> decoded_padded(5);
+  const std::byte* in = buffer.data();
+  in = st::decode(in, decoded_quantities.data(), decoded_quantities.size());
+  in = st::decode(in, decoded_prices.data(), decoded_prices.size());
+  in = st::decode(in, decoded_padded.data(), decoded_padded.size());
+  ASSERT_EQ(in, out);
+  ASSERT_EQ(decoded_quantities, quantities);
+  ASSERT_EQ(decoded_prices, prices);
+  for (std::size_t i = 0; i < 5; ++i) {
+    ASSERT_EQ(decoded_padded[i].value, padded_values[i].value);
+  }
+
+  // Plain numbers in an explicit byte order
+  const std::uint32_t raw[] = {0x01020304u, 0x05060708u};
+  std::byte raw_buffer[8];
+  st::encode<st::endianness::big>(raw, 2, raw_buffer);
+  ASSERT_EQ(raw_buffer[0], std::byte{1});
+  ASSERT_EQ(raw_buffer[7], std::byte{8});
+
+#ifdef __cpp_lib_span
+  std::span<std::byte> rest =
+      st::encode(std::span(quantities).first(2), std::span(buffer));
+  ASSERT_EQ(rest.size(), buffer.size() - 8);
+  const std::vector<quantity>& constant = quantities;
+  rest = st::encode(std::span(constant).first(2), std::span(buffer));
+  ASSERT_EQ(rest.size(), buffer.size() - 8);
+  quantity two[2];
+  auto remaining =
+      st::decode(std::span<const std::byte>(buffer), std::span(two));
+  ASSERT_EQ(remaining.size(), buffer.size() - 8);
+  ASSERT_EQ(two[1], quantities[1]);
+#endif
+}
+
+#endif  // __cpp_lib_byte
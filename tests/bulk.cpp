@@ -0,0 +1,227 @@
+#include <gtest/gtest.h>
+
+#include <strong_types.hpp>
+#include <strong_types/bulk.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace st = dpsg::strong_types;
+
+namespace {
+using price = st::number<double, struct price_tag>;
+using count = st::number<int, struct count_tag>;
+using label = st::strong_value<std::string, struct label_tag, st::arithmetic>;
+
+template <class T, class U, class... Ts>
+using derive_number = st::derive_t<T,
+                                   st::arithmetic,
+                                   st::comparable,
+                                   st::arithmetically_compatible_with<U>,
+                                   st::comparable_with<U>,
+                                   Ts...>;
+
+struct mass : derive_number<mass, double> {
+  constexpr mass() noexcept = default;
+  constexpr explicit mass(double m) noexcept : value{m} {}
+  double value{};
+};
+struct acceleration
+    : derive_number<acceleration,
+                    double,
+                    st::commutative_under<st::multiplies,
+                                          mass,
+                                          st::construct_t<struct force>>> {
+  constexpr acceleration() noexcept = default;
+  constexpr explicit acceleration(double a) noexcept : value{a} {}
+  double value{};
+};
+struct force : derive_number<force, double> {
+  constexpr force() noexcept = default;
+  constexpr explicit force(double f) noexcept : value{f} {}
+  double value{};
+};
+
+// Longer than any SIMD register, and not a multiple of its width, so that
+// both the vector loop and the scalar tail are exercised.
+constexpr std::size_t size = 37;
+
+template <class T>
+std::vector<T> sequence(int first) {
+  std::vector<T> result;
+  for (std::size_t i = 0; i < size; ++i) {
+    result.emplace_back(static_cast<decltype(T::value)>(first) +
+                        static_cast<decltype(T::value)>(i));
+  }
+  return result;
+}
+}  // namespace
+
+TEST(Bulk, FastPath) {
+  using namespace st::detail::bulk;
+  static_assert(is_plain<st::plus, price, price, price>::value, "");
+  static_assert(is_plain<st::multiplies, price, double, price>::value, "");
+  static_assert(is_plain<st::multiplies, mass, acceleration, force>::value, "");
+  static_assert(is_plain_ordering<count>::value, "");
+  static_assert(!is_plain<st::plus, label, label, label>::value, "");
+}
+
+TEST(Bulk, Arithmetic) {
+  const auto left = sequence<price>(1);
+  const auto right = sequence<price>(10);
+  std::vector<price> out(size);
+
+  st::add(left.data(), right.data(), out.data(), size);
+  for (std::size_t i = 0; i < size; ++i) {
+    ASSERT_EQ(out[i], left[i] + right[i]);
+  }
+
+  st::subtract(right.data(), left.data(), out.data(), size);
+  for (std::size_t i = 0; i < size; ++i) {
+    ASSERT_EQ(out[i], price{9.});
+  }
+
+  st::divide(right.data(), left.data(), out.data(), size);
+  for (std::size_t i = 0; i < size; ++i) {
+    ASSERT_EQ(out[i], right[i] / left[i]);
+  }
+
+  const auto counts = sequence<count>(0);
+  std::vector<count> products(size);
+  st::multiply(counts.data(), counts.data(), products.data(), size);
+  for (std::size_t i = 0; i < size; ++i) {
+    ASSERT_EQ(products[i], counts[i] * counts[i]);
+  }
+}
+
+TEST(Bulk, CompatibleTypes) {
+  const auto masses = sequence<mass>(1);
+  const auto accelerations = sequence<acceleration>(2);
+  std::vector<force> forces(size);
+
+  st::multiply(masses.data(), accelerations.data(), forces.data(), size);
+  for (std::size_t i = 0; i < size; ++i) {
+    ASSERT_EQ(forces[i], masses[i] * accelerations[i]);
+  }
+
+  st::multiply(accelerations.data(), masses.data(), forces.data(), size);
+  for (std::size_t i = 0; i < size; ++i) {
+    ASSERT_EQ(forces[i], accelerations[i] * masses[i]);
+  }
+}
+
+TEST(Bulk, ScaleAndFma) {
+  const auto prices = sequence<price>(1);
+  std::vector<price> out(size);
+
+  st::scale(prices.data(), 2., out.data(), size);
+  for (std::size_t i = 0; i < size; ++i) {
+    ASSERT_EQ(out[i], prices[i] * 2.);
+  }
+
+  const std::vector<double> factors(size, 3.);
+  st::fma(prices.data(), factors.data(), prices.data(), out.data(), size);
+  for (std::size_t i = 0; i < size; ++i) {
+    ASSERT_EQ(out[i], prices[i] * 4.);
+  }
+}
+
+TEST(Bulk, MinMax) {
+  const auto ascending = sequence<count>(0);
+  std::vector<count> descending(ascending.rbegin(), ascending.rend());
+  std::vector<count> lesser(size);
+  std::vector<count> greater(size);
+
+  st::min(ascending.data(), descending.data(), lesser.data(), size);
+  st::max(ascending.data(), descending.data(), greater.data(), size);
+  for (std::size_t i = 0; i < size; ++i) {
+    ASSERT_EQ(lesser[i], ascending[i] < descending[i] ? ascending[i]
+                                                      : descending[i]);
+    ASSERT_EQ(greater[i], ascending[i] < descending[i] ? descending[i]
+                                                       : ascending[i]);
+  }
+}
+
+TEST(Bulk, MinMaxNaN) {
+  // Like the comparison of min and max on a single value, an unordered
+  // comparison keeps the left element, whether it is in the vector loop or in
+  // the scalar tail of any length
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<price> left = sequence<price>(0);
+  std::vector<price> right(left.rbegin(), left.rend());
+  for (std::size_t i = 0; i < size; ++i) {
+    if (i % 3 == 0) {
+      left[i] = price{nan};
+    }
+    else if (i % 3 == 1) {
+      right[i] = price{nan};
+    }
+  }
+  std::vector<price> lesser(size);
+  std::vector<price> greater(size);
+  for (std::size_t length = 1; length <= size; ++length) {
+    st::min(left.data(), right.data(), lesser.data(), length);
+    st::max(left.data(), right.data(), greater.data(), length);
+    for (std::size_t i = 0; i < length; ++i) {
+      if (std::isnan(left[i].value)) {
+        ASSERT_TRUE(std::isnan(lesser[i].value)) << length << ' ' << i;
+        ASSERT_TRUE(std::isnan(greater[i].value)) << length << ' ' << i;
+      }
+      else {
+        ASSERT_EQ(lesser[i], right[i] < left[i] ? right[i] : left[i])
+            << length << ' ' << i;
+        ASSERT_EQ(greater[i], left[i] < right[i] ? right[i] : left[i])
+            << length << ' ' << i;
+      }
+    }
+  }
+}
+
+TEST(Bulk, Reductions) {
+  const auto counts = sequence<count>(1);
+  static_assert(std::is_same<decltype(st::sum(counts.data(), size)), count>::value,
+                "");
+  ASSERT_EQ(st::sum(counts.data(), size), count{703});
+  ASSERT_EQ(st::sum(counts.data(), 0), count{0});
+  ASSERT_EQ(st::dot(counts.data(), counts.data(), 3), count{14});
+
+  const auto masses = sequence<mass>(1);
+  const std::vector<acceleration> accelerations(size, acceleration{2.});
+  static_assert(std::is_same<decltype(st::dot(masses.data(),
+                                              accelerations.data(), size)),
+                             force>::value,
+                "");
+  ASSERT_EQ(st::dot(masses.data(), accelerations.data(), size), force{1406.});
+}
+
+TEST(Bulk, GenericPath) {
+  const std::vector<label> left{label{"a"}, label{"b"}};
+  const std::vector<label> right{label{"c"}, label{"d"}};
+  std::vector<label> out(2);
+  st::add(left.data(), right.data(), out.data(), 2);
+  ASSERT_EQ(out[0].value, "ac");
+  ASSERT_EQ(out[1].value, "bd");
+  ASSERT_EQ(st::sum(left.data(), 2).value, "ab");
+}
+
+#ifdef __cpp_lib_span
+TEST(Bulk, Spans) {
+  const auto left = sequence<price>(1);
+  const auto right = sequence<price>(2);
+  std::vector<price> out(size);
+
+  st::add(std::span{left}, std::span{right}, std::span{out});
+  ASSERT_EQ(out[0], price{3.});
+  st::scale(std::span{left}, 0.5, std::span{out});
+  ASSERT_EQ(out[1], price{1.});
+  st::max(std::span{left}, std::span{right}, std::span{out});
+  ASSERT_EQ(out[2], price{4.});
+  ASSERT_EQ(st::sum(std::span{left}.first(3)), price{6.});
+  ASSERT_EQ(st::dot(std::span{left}.first(2), std::span{right}.first(2)),
+            price{8.});
+}
+#endif
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <strong_types/charconv.hpp>
+
+// <charconv> requires C++17
+#ifdef __cpp_lib_to_chars
+
+#include <cstdint>
+#include <string>
+#include <system_error>
+
+namespace st = dpsg::strong_types;
+
+namespace {
+using price = st::number<double, struct price_tag, st::charconv_formattable>;
+using quantity =
+    st::number<std::int32_t, struct quantity_tag, st::charconv_formattable>;
+using lot = st::number<std::int32_t,
+                       struct lot_tag,
+                       st::charconv_formattable_as<std::int64_t>>;
+
+template <class T, class... Args>
+std::string print(const T& value, Args... args) {
+  char buffer[64];
+  const auto result = to_chars(buffer, buffer + sizeof buffer, value, args...);
+  EXPECT_EQ(result.ec, std::errc{});
+  return std::string(buffer, result.ptr);
+}
+}  // namespace
+
+TEST(Charconv, Single) {
+  ASSERT_EQ(print(price{101.25}), "101.25");
+  ASSERT_EQ(print(price{101.25}, std::chars_format::fixed, 3), "101.250");
+  ASSERT_EQ(print(quantity{-42}), "-42");
+  ASSERT_EQ(print(quantity{255}, 16), "ff");
+  ASSERT_EQ(print(lot{7}), "7");
+
+  char small[2];
+  ASSERT_EQ(to_chars(small, small + 2, quantity{1000}).ec,
+            std::errc::value_too_large);
+
+  const std::string text = "-17 1e3 x";
+  quantity q{1};
+  auto result = from_chars(text.data(), text.data() + text.size(), q);
+  ASSERT_EQ(result.ec, std::errc{});
+  ASSERT_EQ(q, -17);
+  price p{0.};
+  result = from_chars(result.ptr + 1, text.data() + text.size(), p);
+  ASSERT_EQ(result.ec, std::errc{});
+  ASSERT_EQ(p, 1000.);
+  result = from_chars(result.ptr + 1, text.data() + text.size(), q);
+  ASSERT_EQ(result.ec, std::errc::invalid_argument);
+  ASSERT_EQ(q, -17);
+
+  const std::string hex = "ff";
+  ASSERT_EQ(from_chars(hex.data(), hex.data() + hex.size(), q, 16).ec,
+            std::errc{});
+  ASSERT_EQ(q, 255);
+}
+
+TEST(Charconv, Bulk) {
+  const price prices[] = {price{1.5}, price{-2.}, price{1e-3}};
+  char buffer[64];
+  auto written = st::to_chars_n(buffer, buffer + sizeof buffer, prices, 3, ',');
+  ASSERT_EQ(written.ec, std::errc{});
+  ASSERT_EQ(std::string(buffer, written.ptr), "1.5,-2,0.001");
+
+  ASSERT_EQ(st::to_chars_n(buffer, buffer + 6, prices, 3, ',').ec,
+            std::errc::value_too_large);
+
+  price parsed[4]{};
+  auto read = st::from_chars_n(buffer, written.ptr, parsed, 4, ',');
+  ASSERT_EQ(read.ec, std::errc{});
+  ASSERT_EQ(read.count, 3u);
+  ASSERT_EQ(read.ptr, written.ptr);
+  for (int i = 0; i < 3; ++i) {
+    ASSERT_EQ(parsed[i], prices[i]);
+  }
+
+  const std::string quantities = "1 2 three 4";
+  quantity q[4]{};
+  const auto partial =
+      st::from_chars_n(quantities.data(), quantities.data() + quantities.size(),
+                       q, 4, ' ');
+  ASSERT_EQ(partial.ec, std::errc::invalid_argument);
+  ASSERT_EQ(partial.count, 2u);
+  ASSERT_EQ(q[1], 2);
+
+  // Plain numbers are accepted too
+  const int raw[] = {10, 20};
+  written = st::to_chars_n(buffer, buffer + sizeof buffer, raw, 2, ';');
+  ASSERT_EQ(std::string(buffer, written.ptr), "10;20");
+
+#ifdef __cpp_lib_span
+  written = st::to_chars_n(buffer, buffer + sizeof buffer,
+                           std::span<const price>(prices), ' ',
+                           std::chars_format::fixed, 1);
+  ASSERT_EQ(std::string(buffer, written.ptr), "1.5 -2.0 0.0");
+#endif
+}
+
+#endif  // __cpp_lib_to_chars
@@ -0,0 +1,65 @@
+# Checks that every strong_<kernel> function in the given object files
+# disassembles to the same instructions as the matching raw_<kernel> function.
+#
+# Usage: cmake -DOBJDUMP=<objdump> -DOBJECTS=<object>[;<object>...] -P compare.cmake
+
+if (NOT OBJDUMP OR NOT OBJECTS)
+  message(FATAL_ERROR "usage: cmake -DOBJDUMP=<objdump> -DOBJECTS=<objects> -P compare.cmake")
+endif()
+
+set(kernels "")
+foreach(object ${OBJECTS})
+  execute_process(
+    COMMAND ${OBJDUMP} -d --no-show-raw-insn ${object}
+    OUTPUT_VARIABLE disassembly
+    ERROR_VARIABLE error
+    RESULT_VARIABLE result)
+  if (result)
+    message(FATAL_ERROR "${OBJDUMP} failed on ${object}: ${error}")
+  endif()
+
+  string(REPLACE ";" "\\;" disassembly "${disassembly}")
+  string(REPLACE "\n" ";" lines "${disassembly}")
+  set(current "")
+  foreach(line IN LISTS lines)
+    if (line MATCHES "^[0-9a-fA-F]+ <_?(raw|strong)_([A-Za-z0-9_]+)>:$")
+      set(current "${CMAKE_MATCH_1}_${CMAKE_MATCH_2}")
+      set(code_${current} "")
+      if (CMAKE_MATCH_1 STREQUAL "strong")
+        list(APPEND kernels ${CMAKE_MATCH_2})
+      endif()
+    elseif (line MATCHES "^[0-9a-fA-F]+ <.*>:$" OR line MATCHES "^Disassembly of")
+      set(current "")
+    elseif (current AND line MATCHES "^ *[0-9a-fA-F]+:[ \t]*(.*)$")
+      set(instruction "${CMAKE_MATCH_1}")
+      # Symbolic annotations name the function itself, drop them
+      string(REGEX REPLACE "<[^>]*>" "" instruction "${instruction}")
+      string(REGEX REPLACE "[ \t]+" " " instruction "${instruction}")
+      string(STRIP "${instruction}" instruction)
+      string(APPEND code_${current} "    ${instruction}\n")
+    endif()
+  endforeach()
+endforeach()
+
+list(LENGTH kernels kernel_count)
+if (kernel_count EQUAL 0)
+  message(FATAL_ERROR "No strong_<kernel> function found in ${OBJECTS}")
+endif()
+
+set(failures 0)
+foreach(kernel ${kernels})
+  if (NOT DEFINED code_raw_${kernel})
+    message(SEND_ERROR "strong_${kernel} has no raw_${kernel} counterpart")
+    math(EXPR failures "${failures} + 1")
+  elseif (NOT code_raw_${kernel} STREQUAL code_strong_${kernel})
+    message(SEND_ERROR "strong_${kernel} differs from raw_${kernel}\n"
+      "  raw_${kernel}:\n${code_raw_${kernel}}"
+      "  strong_${kernel}:\n${code_strong_${kernel}}")
+    math(EXPR failures "${failures} + 1")
+  endif()
+endforeach()
+
+if (failures GREATER 0)
+  message(FATAL_ERROR "${failures} of ${kernel_count} kernels generate different code")
+endif()
+message(STATUS "${kernel_count} kernels generate the same code as their raw counterparts")
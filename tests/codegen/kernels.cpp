@@ -0,0 +1,228 @@
+// Kernels compiled to an object file and disassembled by compare.cmake. Every
+// function named strong_<kernel> must compile to exactly the same machine code
+// as raw_<kernel>, which performs the same operation on the underlying types.
+// Functions are extern "C" so that their symbols are easy to pair up.
+
+#include <strong_types.hpp>
+#include <strong_types/flags.hpp>
+
+namespace st = dpsg::strong_types;
+
+#ifdef __clang__
+#pragma clang diagnostic ignored "-Wreturn-type-c-linkage"
+#endif
+
+namespace {
+
+template <class Op, class Result = st::passthrough_t>
+struct unary {
+  template <class T>
+  using type = st::implement_unary_operation<Op, T, Result>;
+};
+
+template <class T>
+using bitwise_operations =
+    st::derive_t<T,
+                 st::comparable,
+                 st::symmetric<st::binary_and, st::construct_t<T>>,
+                 st::symmetric<st::binary_or, st::construct_t<T>>,
+                 st::symmetric<st::binary_xor, st::construct_t<T>>,
+                 st::symmetric<st::shift_left, st::construct_t<T>>,
+                 st::symmetric<st::shift_right, st::construct_t<T>>,
+                 st::symmetric<st::binary_and_assign, st::construct_t<T>>,
+                 st::symmetric<st::binary_or_assign, st::construct_t<T>>,
+                 st::symmetric<st::binary_xor_assign, st::construct_t<T>>,
+                 st::symmetric<st::shift_left_assign, st::construct_t<T>>,
+                 st::symmetric<st::shift_right_assign, st::construct_t<T>>,
+                 unary<st::binary_not, st::construct_t<T>>>;
+
+struct bits : bitwise_operations<bits> {
+  constexpr explicit bits(unsigned v) noexcept : value{v} {}
+  unsigned value;
+};
+
+}  // namespace
+
+using integer = st::number<int, struct integer_tag>;
+using real = st::number<double, struct real_tag>;
+using boolean =
+    st::strong_value<bool,
+                     struct boolean_tag,
+                     st::symmetric<st::boolean_and, st::construct_t<bool>>,
+                     st::symmetric<st::boolean_or, st::construct_t<bool>>,
+                     unary<st::boolean_not>>;
+using pointer =
+    st::strong_value<int*, struct pointer_tag, unary<st::dereference>>;
+using addressable =
+    st::strong_value<int, struct addressable_tag, unary<st::address_of>>;
+
+enum class permission : unsigned { none = 0, read = 1, write = 2, execute = 4 };
+using permissions = st::flag<permission, struct permissions_tag>;
+
+#define DPSG_BINARY_KERNEL(name, raw_type, strong_type, sym)              \
+  extern "C" auto raw_##name(raw_type left, raw_type right) {            \
+    return left sym right;                                                \
+  }                                                                       \
+  extern "C" auto strong_##name(strong_type left, strong_type right) {   \
+    return left sym right;                                                \
+  }
+
+#define DPSG_MIXED_KERNEL(name, raw_type, strong_type, sym)               \
+  extern "C" auto raw_##name(raw_type left, raw_type right) {            \
+    return left sym right;                                                \
+  }                                                                       \
+  extern "C" auto strong_##name(strong_type left, raw_type right) {      \
+    return left sym right;                                                \
+  }
+
+#define DPSG_SELF_ASSIGN_KERNEL(name, raw_type, strong_type, sym)         \
+  extern "C" void raw_##name(raw_type& left, raw_type right) {           \
+    left sym right;                                                       \
+  }                                                                       \
+  extern "C" void strong_##name(strong_type& left, strong_type right) {  \
+    left sym right;                                                       \
+  }
+
+#define DPSG_UNARY_KERNEL(name, raw_type, strong_type, sym)                  \
+  extern "C" auto raw_##name(raw_type arg) { return sym arg; }              \
+  extern "C" auto strong_##name(strong_type arg) { return sym arg; }
+
+// DPSG_APPLY_TO_BINARY_OPERATORS
+DPSG_BINARY_KERNEL(plus_int, int, integer, +)
+DPSG_BINARY_KERNEL(minus_int, int, integer, -)
+DPSG_BINARY_KERNEL(divides_int, int, integer, /)
+DPSG_BINARY_KERNEL(multiplies_int, int, integer, *)
+DPSG_BINARY_KERNEL(modulo_int, int, integer, %)
+DPSG_BINARY_KERNEL(equal_int, int, integer, ==)
+DPSG_BINARY_KERNEL(not_equal_int, int, integer, !=)
+DPSG_BINARY_KERNEL(lesser_int, int, integer, <)
+DPSG_BINARY_KERNEL(greater_int, int, integer, >)
+DPSG_BINARY_KERNEL(lesser_equal_int, int, integer, <=)
+DPSG_BINARY_KERNEL(greater_equal_int, int, integer, >=)
+DPSG_BINARY_KERNEL(binary_or, unsigned, bits, |)
+DPSG_BINARY_KERNEL(binary_and, unsigned, bits, &)
+DPSG_BINARY_KERNEL(binary_xor, unsigned, bits, ^)
+DPSG_BINARY_KERNEL(shift_right, unsigned, bits, <<)
+DPSG_BINARY_KERNEL(shift_left, unsigned, bits, >>)
+DPSG_BINARY_KERNEL(boolean_or, const bool&, const boolean&, ||)
+DPSG_BINARY_KERNEL(boolean_and, const bool&, const boolean&, &&)
+
+DPSG_BINARY_KERNEL(plus_double, double, real, +)
+DPSG_BINARY_KERNEL(minus_double, double, real, -)
+DPSG_BINARY_KERNEL(divides_double, double, real, /)
+DPSG_BINARY_KERNEL(multiplies_double, double, real, *)
+DPSG_BINARY_KERNEL(equal_double, double, real, ==)
+DPSG_BINARY_KERNEL(lesser_double, double, real, <)
+DPSG_BINARY_KERNEL(greater_equal_double, double, real, >=)
+
+DPSG_MIXED_KERNEL(plus_mixed_int, int, integer, +)
+DPSG_MIXED_KERNEL(multiplies_mixed_int, int, integer, *)
+DPSG_MIXED_KERNEL(lesser_mixed_int, int, integer, <)
+DPSG_MIXED_KERNEL(plus_mixed_double, double, real, +)
+DPSG_MIXED_KERNEL(multiplies_mixed_double, double, real, *)
+
+// DPSG_APPLY_TO_SELF_ASSIGNING_BINARY_OPERATORS
+DPSG_SELF_ASSIGN_KERNEL(plus_assign, int, integer, +=)
+DPSG_SELF_ASSIGN_KERNEL(minus_assign, int, integer, -=)
+DPSG_SELF_ASSIGN_KERNEL(divides_assign, int, integer, /=)
+DPSG_SELF_ASSIGN_KERNEL(multiplies_assign, int, integer, *=)
+DPSG_SELF_ASSIGN_KERNEL(modulo_assign, int, integer, %=)
+DPSG_SELF_ASSIGN_KERNEL(shift_right_assign, unsigned, bits, <<=)
+DPSG_SELF_ASSIGN_KERNEL(shift_left_assign, unsigned, bits, >>=)
+DPSG_SELF_ASSIGN_KERNEL(binary_and_assign, unsigned, bits, &=)
+DPSG_SELF_ASSIGN_KERNEL(binary_or_assign, unsigned, bits, |=)
+DPSG_SELF_ASSIGN_KERNEL(binary_xor_assign, unsigned, bits, ^=)
+DPSG_SELF_ASSIGN_KERNEL(plus_assign_double, double, real, +=)
+DPSG_SELF_ASSIGN_KERNEL(multiplies_assign_double, double, real, *=)
+
+// DPSG_APPLY_TO_UNARY_OPERATORS
+DPSG_UNARY_KERNEL(boolean_not, const bool&, const boolean&, !)
+DPSG_UNARY_KERNEL(binary_not, unsigned, bits, ~)
+DPSG_UNARY_KERNEL(negate, int, integer, -)
+DPSG_UNARY_KERNEL(positivate, int, integer, +)
+DPSG_UNARY_KERNEL(dereference, int*, pointer, *)
+DPSG_UNARY_KERNEL(address_of, int&, addressable&, &)
+DPSG_UNARY_KERNEL(increment, int&, integer&, ++)
+DPSG_UNARY_KERNEL(decrement, int&, integer&, --)
+DPSG_UNARY_KERNEL(negate_double, double, real, -)
+
+// flags.hpp
+namespace {
+using underlying = std::underlying_type_t<permission>;
+}  // namespace
+
+#define DPSG_RAW_FLAG_OPERATION(left, sym, right) \
+  static_cast<permission>(static_cast<underlying>(left)  \
+                              sym static_cast<underlying>(right))
+
+extern "C" permission raw_flag_or(permission left, permission right) {
+  return DPSG_RAW_FLAG_OPERATION(left, |, right);
+}
+extern "C" permissions strong_flag_or(permissions left, permissions right) {
+  return left | right;
+}
+extern "C" permission raw_flag_and(permission left, permission right) {
+  return DPSG_RAW_FLAG_OPERATION(left, &, right);
+}
+extern "C" permissions strong_flag_and(permissions left, permissions right) {
+  return left & right;
+}
+extern "C" permission raw_flag_xor(permission left, permission right) {
+  return DPSG_RAW_FLAG_OPERATION(left, ^, right);
+}
+extern "C" permissions strong_flag_xor(permissions left, permissions right) {
+  return left ^ right;
+}
+extern "C" permission raw_flag_or_enum(permission left, permission right) {
+  return DPSG_RAW_FLAG_OPERATION(left, |, right);
+}
+extern "C" permissions strong_flag_or_enum(permissions left,
+                                           permission right) {
+  return left | right;
+}
+// The operands are passed by reference: when a structure and a scalar are
+// passed by value, GCC numbers their values differently and emits the
+// operands of commutative instructions in another order.
+extern "C" permission raw_flag_and_enum(const permission& left,
+                                        const permission& right) {
+  return DPSG_RAW_FLAG_OPERATION(left, &, right);
+}
+extern "C" permissions strong_flag_and_enum(const permission& left,
+                                            const permissions& right) {
+  return left & right;
+}
+extern "C" permission raw_flag_not(permission arg) {
+  return static_cast<permission>(~static_cast<underlying>(arg));
+}
+extern "C" permissions strong_flag_not(permissions arg) { return ~arg; }
+extern "C" void raw_flag_or_assign(permission& left, permission right) {
+  left = DPSG_RAW_FLAG_OPERATION(left, |, right);
+}
+extern "C" void strong_flag_or_assign(permissions& left, permissions right) {
+  left |= right;
+}
+extern "C" void raw_flag_and_assign_enum(permission& left, permission right) {
+  left = DPSG_RAW_FLAG_OPERATION(left, &, right);
+}
+extern "C" void strong_flag_and_assign_enum(permissions& left,
+                                            permission right) {
+  left &= right;
+}
+extern "C" void raw_flag_xor_assign(permission& left, permission right) {
+  left = DPSG_RAW_FLAG_OPERATION(left, ^, right);
+}
+extern "C" void strong_flag_xor_assign(permissions& left, permissions right) {
+  left ^= right;
+}
+extern "C" bool raw_flag_equal(permission left, permission right) {
+  return left == right;
+}
+extern "C" bool strong_flag_equal(permissions left, permissions right) {
+  return left == right;
+}
+extern "C" bool raw_flag_equal_enum(permission left, permission right) {
+  return left == right;
+}
+extern "C" bool strong_flag_equal_enum(permissions left, permission right) {
+  return left == right;
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+
+#include <strong_types/csv.hpp>
+
+// <charconv> requires C++17
+#ifdef __cpp_lib_to_chars
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+
+namespace st = dpsg::strong_types;
+
+namespace {
+using order_id = st::strong_value<std::uint64_t, struct order_id_tag>;
+using price = st::number<double, struct price_tag, st::charconv_formattable>;
+using quantity = st::number<std::int32_t, struct quantity_tag>;
+using symbol = st::strong_value<std::string, struct symbol_tag>;
+
+using trades = st::csv_reader<order_id, symbol, price, quantity>;
+
+const std::string text =
+    "id,symbol,price,quantity\n"
+    "1,AAPL,189.5,100\r\n"
+    "\n"
+    "2,MSFT,402.25,-20\n"
+    "3,LONGER_SYMBOL_NAME_THAN_A_BLOCK,0.001,7\n"
+    "4,X,1e3,0";
+
+void check(const trades& reader) {
+  ASSERT_EQ(reader.size(), 4u);
+  ASSERT_EQ(reader.column<order_id>()[3].value, 4u);
+  ASSERT_EQ(reader.column<symbol>()[0].value, "AAPL");
+  ASSERT_EQ(reader.column<symbol>()[2].value,
+            "LONGER_SYMBOL_NAME_THAN_A_BLOCK");
+  ASSERT_EQ(reader.column<price>()[1], price{402.25});
+  ASSERT_EQ(reader.column<price>()[3], price{1000.});
+  ASSERT_EQ(reader.column<3>()[0], quantity{100});
+  ASSERT_EQ(reader.column<3>()[1], quantity{-20});
+}
+}  // namespace
+
+TEST(Csv, WholeText) {
+  trades reader{',', 1};
+  reader.feed(text);
+  ASSERT_EQ(reader.size(), 3u);
+  reader.finish();
+  check(reader);
+  ASSERT_EQ(reader.lines(), 6u);
+}
+
+TEST(Csv, Chunks) {
+  // Every line is split at every position
+  for (std::size_t chunk = 1; chunk < text.size(); ++chunk) {
+    trades reader{',', 1};
+    for (std::size_t i = 0; i < text.size(); i += chunk) {
+      reader.feed(text.substr(i, chunk));
+    }
+    reader.finish();
+    check(reader);
+  }
+
+  std::istringstream stream{text};
+  trades reader{',', 1};
+  reader.read(stream, 7);
+  check(reader);
+}
+
+TEST(Csv, Errors) {
+  using pair = st::csv_reader<quantity, quantity>;
+  pair semicolons{';'};
+  semicolons.feed(std::string("1;2\n3;4\n"));
+  ASSERT_EQ(semicolons.column<1>()[1], quantity{4});
+
+  const auto error_of = [](const std::string& line) {
+    pair reader;
+    try {
+      reader.feed(line);
+    } catch (const st::csv_error& error) {
+      return std::make_pair(error.line(), error.column());
+    }
+    return std::pair<std::size_t, std::size_t>(0, 0);
+  };
+  using position = std::pair<std::size_t, std::size_t>;
+  ASSERT_EQ(error_of("1,2\n3\n"), position(2, 1));
+  ASSERT_EQ(error_of("1,2,3\n"), position(1, 3));
+  ASSERT_EQ(error_of("1,x\n"), position(1, 2));
+  ASSERT_EQ(error_of("1,2 \n"), position(1, 2));
+  ASSERT_EQ(error_of(",2\n"), position(1, 1));
+  // Out of range
+  ASSERT_EQ(error_of("1,99999999999\n"), position(1, 2));
+}
+
+#endif  // __cpp_lib_to_chars
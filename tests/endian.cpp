@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <strong_types/endian.hpp>
+#include <strong_types/flags.hpp>
+
+// std::byte requires C++17
+#ifdef __cpp_lib_byte
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace st = dpsg::strong_types;
+
+namespace {
+enum class message_flags : std::uint8_t { snapshot = 1, last = 2 };
+
+using sequence = st::number<std::uint32_t, struct sequence_tag>;
+using symbol_id = st::strong_value<std::uint16_t, struct symbol_id_tag>;
+using price = st::number<double, struct price_tag>;
+using flags = st::flag<message_flags, struct flags_tag>;
+
+struct packet_header {
+  st::big_endian<sequence> sequence_number;
+  st::big_endian<symbol_id> symbol;
+  st::little_endian<price> last_price;
+  st::big_endian<flags> message_flags;
+};
+
+static_assert(sizeof(packet_header) == 4 + 2 + 8 + 1,
+              "endian storages have no padding");
+static_assert(alignof(packet_header) == 1,
+              "endian storages can be placed anywhere");
+static_assert(std::is_standard_layout<packet_header>::value &&
+                  std::is_trivially_copyable<packet_header>::value,
+              "packets can be placed over buffers");
+}  // namespace
+
+TEST(Endian, Overlay) {
+  const unsigned char received[] = {
+      0xFF,                    // end of the previous message
+      0x00, 0x00, 0x01, 0x02,  // sequence number
+      0x00, 0x2A,              // symbol
+      0,    0,    0,    0,    0, 0, 0xF8, 0x3F,  // 1.5 in little endian
+      0x03};                                     // flags
+  std::byte buffer[sizeof received];
+  std::memcpy(buffer, received, sizeof received);
+
+  // Placed over the buffer, without alignment requirement
+  const auto* header = reinterpret_cast<const packet_header*>(buffer + 1);
+  ASSERT_EQ(header->sequence_number.load(), sequence{0x0102u});
+  ASSERT_EQ(header->symbol.load().value, 42);
+  ASSERT_EQ(header->last_price.load(), price{1.5});
+  ASSERT_EQ(static_cast<flags>(header->message_flags),
+            flags{message_flags::snapshot} | message_flags::last);
+
+  ASSERT_EQ(std::memcmp(header->sequence_number.data(), received + 1, 4), 0);
+}
+
+TEST(Endian, Operators) {
+  st::big_endian<sequence> a{sequence{1000u}};
+  const st::big_endian<sequence> b{sequence{1000u}};
+  const st::little_endian<sequence> c{sequence{1000u}};
+  unsigned char expected[] = {0, 0, 0x03, 0xE8};
+  ASSERT_EQ(std::memcmp(a.data(), expected, 4), 0);
+  ASSERT_EQ(std::memcmp(c.data(), "\xE8\x03\0\0", 4), 0);
+
+  // Equality does not need the values
+  ASSERT_TRUE(a == b);
+  ASSERT_TRUE(a == sequence{1000u});
+  ASSERT_TRUE(sequence{1000u} == a);
+  ASSERT_FALSE(a != b);
+  ASSERT_TRUE(a == c);
+  ASSERT_TRUE(a != sequence{1u});
+
+  // Arithmetic and ordering give strong types in the byte order of the host
+  static_assert(std::is_same<decltype(a + b), sequence>::value, "");
+  ASSERT_EQ(a + b, sequence{2000u});
+  ASSERT_EQ(a - sequence{1u}, sequence{999u});
+  ASSERT_EQ(c * a, sequence{1000000u});
+  ASSERT_TRUE(a < sequence{1001u});
+  ASSERT_TRUE(sequence{999u} < c);
+  ASSERT_FALSE(a > b);
+  ASSERT_TRUE(a >= c);
+
+  a += sequence{24u};
+  ASSERT_EQ(a, sequence{1024u});
+  a -= b;
+  ASSERT_EQ(a, sequence{24u});
+  ASSERT_EQ(a++, sequence{24u});
+  ASSERT_EQ(++a, sequence{26u});
+  --a;
+  ASSERT_EQ(a, sequence{25u});
+  sequence total{1u};
+  total += c;
+  ASSERT_EQ(total, sequence{1001u});
+
+  a = sequence{0x01020304u};
+  unsigned char swapped[] = {1, 2, 3, 4};
+  ASSERT_EQ(std::memcmp(a.data(), swapped, 4), 0);
+
+  st::big_endian<flags> f{flags{message_flags::snapshot}};
+  f |= message_flags::last;
+  ASSERT_EQ(f, flags{message_flags::snapshot} | message_flags::last);
+  ASSERT_EQ(f & message_flags::last, flags{message_flags::last});
+  ASSERT_EQ(~f, ~(flags{message_flags::snapshot} | message_flags::last));
+
+  // Floating point values are compared as values
+  st::big_endian<price> zero{price{0.}};
+  ASSERT_TRUE(zero == price{-0.});
+  ASSERT_EQ(-st::little_endian<price>{price{2.}}, price{-2.});
+}
+
+#endif  // __cpp_lib_byte
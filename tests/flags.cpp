@@ -3,6 +3,9 @@
 #include <strong_types.hpp>
 #include <strong_types/flags.hpp>
 
+#include <cstdint>
+#include <vector>
+
 namespace st = dpsg::strong_types;
 
 TEST(Enum, Basic) {
@@ -40,3 +43,56 @@ TEST(Enum, Basic) {
   ASSERT_EQ((f |= e::b), expected_result);
   ASSERT_EQ(f, expected_result);
 }
+
+namespace {
+enum class permission : std::uint8_t {
+  none = 0,
+  read = 1,
+  write = 2,
+  execute = 4,
+  read_write = 3,
+  admin = 128
+};
+using permissions = st::flag<permission, struct permissions_tag>;
+}  // namespace
+
+TEST(Enum, BitQueries) {
+  constexpr permissions p =
+      permissions{permission::read} | permission::execute | permission::admin;
+  static_assert(st::count(p) == 3, "");
+  static_assert(st::any(p) && !st::none(p), "");
+  static_assert(st::none(permissions{}), "");
+  static_assert(st::all_of(p, permission::read), "");
+  static_assert(!st::all_of(p, permission::read_write), "");
+  static_assert(st::any_of(p, permission::read_write), "");
+  static_assert(!st::any_of(p, permissions{permission::write}), "");
+  static_assert(st::count(permission::read_write) == 2, "");
+
+  std::vector<permission> set;
+  for (permission bit : st::set_bits(p)) {
+    set.push_back(bit);
+  }
+  ASSERT_EQ(set, (std::vector<permission>{permission::read, permission::execute,
+                                          permission::admin}));
+  ASSERT_EQ(st::set_bits(p).size(), 3u);
+  ASSERT_TRUE(st::set_bits(permissions{}).empty());
+
+  std::vector<permission> visited;
+  st::for_each_set_bit(p, [&](permission bit) { visited.push_back(bit); });
+  ASSERT_EQ(visited, set);
+}
+
+TEST(Enum, Enumerators) {
+  static_assert(st::declared_flags<permission>::value ==
+                    static_cast<permission>(1 | 2 | 4 | 128),
+                "only single bit enumerators are declared flags");
+  static_assert(st::enumerators<permission>().size() == 4, "");
+
+  std::vector<permission> all;
+  for (permission bit : st::enumerators<permission>()) {
+    all.push_back(bit);
+  }
+  ASSERT_EQ(all, (std::vector<permission>{permission::read, permission::write,
+                                          permission::execute,
+                                          permission::admin}));
+}
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+
+#include <strong_types/format.hpp>
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+
+namespace st = dpsg::strong_types;
+
+namespace {
+enum class permission : std::uint8_t { read = 1, write = 2, execute = 4 };
+
+using name = st::strong_value<std::string, struct name_tag>;
+using price = st::number<double, struct price_tag>;
+using ratio = st::number<float, struct ratio_tag, st::formattable_as<double>>;
+using code = st::number<char, struct code_tag, st::formattable_as<int>>;
+using permissions = st::flag<permission, struct permissions_tag>;
+}  // namespace
+
+#ifdef __cpp_lib_format
+TEST(Format, StdFormat) {
+  ASSERT_EQ(std::format("{}", name{"alice"}), "alice");
+  ASSERT_EQ(std::format("[{:>7}]", name{"bob"}), "[    bob]");
+  ASSERT_EQ(std::format("{:.2f}", price{3.14159}), "3.14");
+  ASSERT_EQ(std::format("{:+}", ratio{0.5f}), "+0.5");
+  ASSERT_EQ(std::format("{}", code{'A'}), "65");
+  ASSERT_EQ(std::format("{:#04x}",
+                        permissions{permission::read} | permission::execute),
+            "0x05");
+  ASSERT_EQ(std::format(L"{:.1f}", price{2.}), L"2.0");
+
+  char buffer[16];
+  const auto result = std::format_to_n(buffer, sizeof buffer, "{}|{}",
+                                       price{1.5}, name{"x"});
+  ASSERT_EQ(std::string(buffer, result.out), "1.5|x");
+}
+#endif
+
+#ifdef DPSG_STRONG_TYPES_USE_FMT
+TEST(Format, Fmt) {
+  ASSERT_EQ(fmt::format("{}", name{"alice"}), "alice");
+  ASSERT_EQ(fmt::format("[{:>7}]", name{"bob"}), "[    bob]");
+  ASSERT_EQ(fmt::format("{:.2f}", price{3.14159}), "3.14");
+  ASSERT_EQ(fmt::format("{:+}", ratio{0.5f}), "+0.5");
+  ASSERT_EQ(fmt::format("{}", code{'A'}), "65");
+  ASSERT_EQ(fmt::format("{:#04x}",
+                        permissions{permission::read} | permission::execute),
+            "0x05");
+
+  fmt::memory_buffer buffer;
+  fmt::format_to(std::back_inserter(buffer), "{}|{}", price{1.5}, name{"x"});
+  ASSERT_EQ(fmt::to_string(buffer), "1.5|x");
+}
+#endif
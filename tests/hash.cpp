@@ -2,6 +2,10 @@
 
 #include <strong_types/hash.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
 #include <type_traits>
 #include <unordered_set>
 
@@ -13,6 +17,23 @@ using id = dpsg::strong_types::strong_value<int,
 DPSG_STRONG_TYPES_MAKE_HASHABLE(id);
 #endif
 
+namespace st = dpsg::strong_types;
+
+using sequential_id = st::strong_value<std::uint32_t,
+                                       struct sequential_id_tag,
+                                       st::hashable_with<st::fibonacci_hash>,
+                                       st::comparable>;
+using mixed_id = st::number<std::int64_t,
+                            struct mixed_id_tag,
+                            st::hashable_with<st::mix_hash>>;
+using name = st::strong_value<std::string,
+                              struct name_tag,
+                              st::hashable_with<st::wy_hash>,
+                              st::comparable>;
+DPSG_STRONG_TYPES_MAKE_HASHABLE(sequential_id);
+DPSG_STRONG_TYPES_MAKE_HASHABLE(mixed_id);
+DPSG_STRONG_TYPES_MAKE_HASHABLE(name);
+
 TEST(Hash, Basic) {
 #ifdef __cpp_concepts
   using id = dpsg::strong_types::strong_value<int,
@@ -26,3 +47,47 @@ TEST(Hash, Basic) {
   ASSERT_EQ(set.size(), 1);
   ASSERT_EQ(set.count(id{42}), 1);
 }
+
+TEST(Hash, Hashers) {
+  ASSERT_EQ(std::hash<sequential_id>{}(sequential_id{7u}),
+            st::fibonacci_hash{}(7u));
+  ASSERT_EQ(std::hash<mixed_id>{}(mixed_id{7}), st::mix_hash{}(7));
+  ASSERT_EQ(std::hash<name>{}(name{"strong"}),
+            st::wy_hash{}(std::string{"strong"}));
+  ASSERT_EQ(st::wy_hash{}("strong"), st::wy_hash{}(std::string{"strong"}));
+
+#if SIZE_MAX > 0xffffffffu
+  // Fibonacci hashing takes the high bits of the hash as the bucket of a power
+  // of two table: sequential values are spread over the whole table, far from
+  // each other, with at most two of them in the same bucket
+  constexpr std::size_t buckets = 64;
+  constexpr int shift = 64 - 6;
+  std::size_t load[buckets] = {};
+  std::size_t previous = st::fibonacci_hash{}(0u) >> shift;
+  ++load[previous];
+  for (std::uint32_t i = 1; i < buckets; ++i) {
+    const std::size_t bucket = st::fibonacci_hash{}(i) >> shift;
+    const std::size_t distance =
+        bucket > previous ? bucket - previous : previous - bucket;
+    ASSERT_GE(std::min(distance, buckets - distance), buckets / 4) << i;
+    ASSERT_LE(++load[bucket], 2u) << i;
+    previous = bucket;
+  }
+#endif
+}
+
+TEST(Hash, Strings) {
+  // Every length goes through a different path of the hash
+  std::unordered_set<std::size_t> hashes;
+  std::string value;
+  for (std::size_t size = 0; size <= 100; ++size) {
+    hashes.insert(st::wy_hash{}(value));
+    ASSERT_EQ(st::wy_hash{}(value), st::wy_hash{}(std::string{value}));
+    value += static_cast<char>('a' + size % 26);
+  }
+  ASSERT_EQ(hashes.size(), 101);
+
+  std::unordered_set<name> names{name{"a"}, name{"b"}, name{"a"}};
+  ASSERT_EQ(names.size(), 2);
+  ASSERT_EQ(names.count(name{"b"}), 1);
+}
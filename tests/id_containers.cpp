@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <strong_types.hpp>
+#include <strong_types/id_containers.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace st = dpsg::strong_types;
+
+namespace {
+using user_id = st::strong_value<std::uint32_t, struct user_id_tag>;
+using order_id = st::number<std::int64_t, struct order_id_tag>;
+
+template <class Container, class Index, class = void>
+struct is_indexable_with : std::false_type {};
+template <class Container, class Index>
+struct is_indexable_with<
+    Container,
+    Index,
+    st::detail::void_t<decltype(std::declval<Container&>()[std::declval<Index>()])>>
+    : std::true_type {};
+}  // namespace
+
+TEST(IdContainers, Vector) {
+  st::id_vector<user_id, std::string> names;
+  const user_id alice = names.push_back("alice");
+  const user_id bob = names.emplace_back(3, 'b');
+  ASSERT_EQ(alice.value, 0u);
+  ASSERT_EQ(bob.value, 1u);
+  ASSERT_EQ(names.next_id().value, 2u);
+
+  ASSERT_EQ(names[alice], "alice");
+  ASSERT_EQ(names[bob], "bbb");
+  ASSERT_TRUE(names.contains(bob));
+  ASSERT_FALSE(names.contains(user_id{2u}));
+  ASSERT_THROW(names.at(user_id{2u}), std::out_of_range);
+
+  std::vector<std::uint32_t> ids;
+  names.for_each([&ids](user_id id, const std::string&) {
+    ids.push_back(id.value);
+  });
+  ASSERT_EQ(ids, (std::vector<std::uint32_t>{0, 1}));
+
+  static_assert(is_indexable_with<decltype(names), user_id>::value, "");
+  static_assert(!is_indexable_with<decltype(names), order_id>::value, "");
+  static_assert(!is_indexable_with<decltype(names), std::size_t>::value, "");
+}
+
+TEST(IdContainers, VectorOfNumbers) {
+  st::id_vector<order_id, double> prices(3, 1.5);
+  prices[order_id{2}] = 4.;
+  ASSERT_EQ(prices.size(), 3);
+  ASSERT_EQ(prices.at(order_id{2}), 4.);
+  double total = 0;
+  for (double price : prices) {
+    total += price;
+  }
+  ASSERT_EQ(total, 7.);
+}
+
+TEST(IdContainers, Bitset) {
+  st::id_bitset<user_id> users(10);
+  ASSERT_TRUE(users.empty());
+  ASSERT_GE(users.capacity(), 10);
+
+  ASSERT_TRUE(users.insert(user_id{3u}));
+  ASSERT_FALSE(users.insert(user_id{3u}));
+  ASSERT_TRUE(users.insert(user_id{130u}));
+  ASSERT_TRUE(users.insert(user_id{64u}));
+  ASSERT_GE(users.capacity(), 131);
+  ASSERT_EQ(users.count(), 3);
+  ASSERT_TRUE(users.contains(user_id{64u}));
+  ASSERT_FALSE(users.contains(user_id{65u}));
+  ASSERT_FALSE(users.contains(user_id{100000u}));
+
+  std::vector<std::uint32_t> ids;
+  users.for_each([&ids](user_id id) { ids.push_back(id.value); });
+  ASSERT_EQ(ids, (std::vector<std::uint32_t>{3, 64, 130}));
+
+  ASSERT_TRUE(users.erase(user_id{64u}));
+  ASSERT_FALSE(users.erase(user_id{64u}));
+  ASSERT_FALSE(users.erase(user_id{100000u}));
+  ASSERT_EQ(users.count(), 2);
+  users.clear();
+  ASSERT_TRUE(users.empty());
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <strong_types.hpp>
+#include <strong_types/flags.hpp>
+#include <strong_types/layout.hpp>
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace st = dpsg::strong_types;
+
+namespace {
+using price = st::number<double, struct price_tag>;
+using quantity = st::number<std::int32_t,
+                            struct quantity_tag,
+                            st::comparable_with<std::int64_t>,
+                            st::bitwise>;
+using name = st::strong_value<std::string, struct name_tag, st::comparable>;
+
+enum class side : std::uint8_t { none = 0, buy = 1, sell = 2 };
+using sides = st::flag<side, struct sides_tag>;
+}  // namespace
+
+TEST(Layout, Guarantees) {
+  static_assert(st::is_layout_compatible_with_value_v<price>, "");
+  static_assert(st::is_layout_compatible_with_value_v<quantity>, "");
+  static_assert(st::is_layout_compatible_with_value_v<name>, "");
+  static_assert(st::is_layout_compatible_with_value_v<sides>, "");
+
+  static_assert(std::is_trivially_copyable<price>::value, "");
+  static_assert(std::is_standard_layout<quantity>::value, "");
+  static_assert(sizeof(sides) == sizeof(side), "");
+  static_assert(!std::is_trivially_copyable<name>::value, "");
+}
+
+TEST(Layout, Pointers) {
+  std::vector<price> prices{price{1.5}, price{2.5}, price{4.}};
+  double* values = st::as_underlying(prices.data());
+  ASSERT_EQ(values[1], 2.5);
+  values[2] = 8.;
+  ASSERT_EQ(prices[2], 8.);
+
+  const std::int32_t raw[] = {1, 2, 3};
+  const quantity* quantities = st::as_strong<quantity>(raw, 3);
+  ASSERT_EQ(quantities[0] + quantities[2], 4);
+}
+
+#ifdef __cpp_lib_span
+TEST(Layout, Spans) {
+  std::vector<price> prices{price{1.5}, price{2.5}};
+  std::span<double> values = st::as_underlying(std::span{prices});
+  ASSERT_EQ(values.size(), 2);
+  values[0] = 3.;
+  ASSERT_EQ(prices[0], 3.);
+
+  const double raw[] = {1., 2., 3.};
+  std::span<const price, 3> view = st::as_strong<price>(std::span{raw});
+  ASSERT_EQ(view[1], 2.);
+  static_assert(std::is_same_v<decltype(st::as_underlying(view)),
+                               std::span<const double, 3>>);
+}
+#endif
+
+TEST(Layout, CachelineAligned) {
+  using padded = st::number<std::int64_t, struct padded_tag,
+                            st::cacheline_aligned>;
+  static_assert(alignof(padded) == st::cache_line_size, "");
+  static_assert(sizeof(padded) == st::cache_line_size, "");
+  static_assert(!st::is_layout_compatible_with_value_v<padded>,
+                "padded strong types are larger than their value");
+
+  padded counters[2]{padded{1}, padded{2}};
+  const auto distance = reinterpret_cast<const char*>(&counters[1]) -
+                        reinterpret_cast<const char*>(&counters[0]);
+  ASSERT_EQ(static_cast<std::size_t>(distance), st::cache_line_size);
+  ASSERT_EQ(counters[0] + counters[1], 3);
+}
@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include <strong_types.hpp>
+#include <strong_types/lazy.hpp>
+
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace st = dpsg::strong_types;
+
+namespace {
+// A value whose operators reuse the storage of temporaries, and counting the
+// number of values it had to allocate and the number of times it was moved.
+struct decimal {
+  static int allocations;
+  static int moves;
+
+  double digits{};
+
+  decimal() noexcept = default;
+  explicit decimal(double d) : digits{d} { ++allocations; }
+  decimal(const decimal& other) : digits{other.digits} { ++allocations; }
+  decimal(decimal&& other) noexcept : digits{other.digits} { ++moves; }
+  decimal& operator=(const decimal&) = default;
+  decimal& operator=(decimal&&) noexcept = default;
+
+  decimal& operator+=(const decimal& other) {
+    digits += other.digits;
+    return *this;
+  }
+  decimal& operator-=(const decimal& other) {
+    digits -= other.digits;
+    return *this;
+  }
+  decimal& operator*=(const decimal& other) {
+    digits *= other.digits;
+    return *this;
+  }
+  decimal& operator/=(const decimal& other) {
+    digits /= other.digits;
+    return *this;
+  }
+  decimal& operator%=(const decimal&) { return *this; }
+  decimal operator-() const& { return decimal{-digits}; }
+
+#define DPSG_DEFINE_DECIMAL_OPERATOR(sym)                                 \
+  friend decimal operator sym(const decimal& left, const decimal& right) { \
+    decimal result{left};                                                 \
+    result sym## = right;                                                 \
+    return result;                                                        \
+  }                                                                       \
+  friend decimal operator sym(decimal&& left, const decimal& right) {      \
+    return std::move(left sym## = right);                                 \
+  }
+  DPSG_DEFINE_DECIMAL_OPERATOR(+)
+  DPSG_DEFINE_DECIMAL_OPERATOR(-)
+  DPSG_DEFINE_DECIMAL_OPERATOR(*)
+  DPSG_DEFINE_DECIMAL_OPERATOR(/)
+  DPSG_DEFINE_DECIMAL_OPERATOR(%)
+#undef DPSG_DEFINE_DECIMAL_OPERATOR
+
+  friend decimal operator+(const decimal& left, decimal&& right) {
+    return std::move(right += left);
+  }
+  friend decimal operator+(decimal&& left, decimal&& right) {
+    return std::move(left += right);
+  }
+
+  friend decimal operator*(decimal left, double right) {
+    left.digits *= right;
+    return left;
+  }
+  friend decimal operator*(double left, decimal right) {
+    right.digits *= left;
+    return right;
+  }
+  friend bool operator<(const decimal& left, const decimal& right) noexcept {
+    return left.digits < right.digits;
+  }
+  friend bool operator==(const decimal& left, const decimal& right) noexcept {
+    return left.digits == right.digits;
+  }
+};
+int decimal::allocations = 0;
+int decimal::moves = 0;
+
+using amount = st::strong_value<decimal,
+                                struct amount_tag,
+                                st::lazy_arithmetic,
+                                st::lazily_compatible_with<double>>;
+using eager_amount =
+    st::strong_value<decimal, struct eager_amount_tag, st::arithmetic>;
+
+amount make_amount(double d) {
+  return amount{decimal{d}};
+}
+
+struct length : st::derive_t<length, st::lazy_arithmetic> {
+  constexpr explicit length(double v) noexcept : value{v} {}
+  double value;
+};
+struct area : st::derive_t<area, st::lazy_arithmetic> {
+  constexpr explicit area(double v) noexcept : value{v} {}
+  double value;
+};
+struct squares {
+  template <class T>
+  using type = st::implement_lazy_binary_operations<
+      st::black_magic::tuple<st::multiplies>,
+      T,
+      T,
+      st::construct_t<area>>;
+};
+struct side : st::derive_t<side, squares> {
+  constexpr explicit side(double v) noexcept : value{v} {}
+  double value;
+};
+}  // namespace
+
+TEST(Lazy, Expressions) {
+  const amount a = make_amount(1);
+  const amount b = make_amount(2);
+  const amount c = make_amount(3);
+  const amount d = make_amount(4);
+
+  auto expr = a + b * c - d;
+  static_assert(!std::is_same<decltype(expr), amount>::value,
+                "lazy operators return expressions");
+  static_assert(std::is_same<decltype(st::evaluate(expr)), amount>::value,
+                "expressions evaluate to the result of the operation");
+
+  const amount result = expr;
+  ASSERT_EQ(result.value.digits, 3.);
+  ASSERT_EQ(st::evaluate(expr).value.digits, 3.);
+  ASSERT_EQ(amount{a * b}.value.digits, 2.);
+  ASSERT_EQ(st::evaluate(a).value.digits, 1.);
+}
+
+TEST(Lazy, SinglePass) {
+  const amount a = make_amount(1);
+  const amount b = make_amount(2);
+  const amount c = make_amount(3);
+  const amount d = make_amount(4);
+  decimal::allocations = 0;
+  decimal::moves = 0;
+  const amount result = a + b * c - d;
+  ASSERT_EQ(result.value.digits, 3.);
+  // b * c allocates, the following operations reuse its storage
+  ASSERT_EQ(decimal::allocations, 1);
+  // and the value is moved once per operation
+  ASSERT_EQ(decimal::moves, 3);
+  const int lazy_moves = decimal::moves;
+
+  const eager_amount e{decimal{1}};
+  const eager_amount f{decimal{2}};
+  const eager_amount g{decimal{3}};
+  const eager_amount h{decimal{4}};
+  decimal::allocations = 0;
+  decimal::moves = 0;
+  const eager_amount eager = e + f * g - h;
+  ASSERT_EQ(eager.value.digits, 3.);
+  // Eager operations reuse their temporary operands too, but the value is
+  // also moved in and out of the strong type built by each operation
+  ASSERT_EQ(decimal::allocations, 1);
+  ASSERT_GT(decimal::moves, lazy_moves);
+}
+
+TEST(Lazy, MixedOperations) {
+  amount a = make_amount(2);
+  const amount b = make_amount(3);
+
+  const amount scaled = 2. * a * 3. + b;
+  ASSERT_EQ(scaled.value.digits, 15.);
+
+  a += b * b;
+  ASSERT_EQ(a.value.digits, 11.);
+  a = a - b;
+  ASSERT_EQ(a.value.digits, 8.);
+  ASSERT_EQ((-a).value.digits, -8.);
+
+  const amount from_temporaries = make_amount(1) + make_amount(2);
+  ASSERT_EQ(from_temporaries.value.digits, 3.);
+}
+
+TEST(Lazy, ReturnTypes) {
+  const side s{3.};
+  auto expr = s * s + s * s;
+  static_assert(std::is_same<decltype(st::evaluate(expr)), area>::value,
+                "expressions keep the result type of their operations");
+  const area a = expr;
+  ASSERT_EQ(a.value, 18.);
+
+  const length l = length{1.} + length{2.};
+  ASSERT_EQ(l.value, 3.);
+}
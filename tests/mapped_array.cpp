@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <strong_types/mapped_array.hpp>
+
+#ifdef DPSG_STRONG_TYPES_MAPPED_ARRAY
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+namespace st = dpsg::strong_types;
+
+namespace {
+using price = st::number<double, struct price_tag>;
+using cost = st::number<double, struct cost_tag>;
+using order_id = st::strong_value<std::uint64_t, struct order_id_tag>;
+
+static_assert(st::mapped_array<price>::fingerprint !=
+                  st::mapped_array<cost>::fingerprint,
+              "the fingerprint depends on the tag");
+static_assert(st::mapped_array<price>::fingerprint ==
+                  st::mapped_array<const price>::fingerprint,
+              "the fingerprint does not depend on the access");
+
+std::string temporary_file(const char* name) {
+  return testing::TempDir() + "strong_types_" + name;
+}
+}  // namespace
+
+TEST(MappedArray, CreateAndOpen) {
+  const std::string path = temporary_file("prices");
+  {
+    auto prices = st::mapped_array<price>::create(path, 1000);
+    ASSERT_EQ(prices.size(), 1000u);
+    ASSERT_EQ(prices[999], price{0.});
+    for (std::size_t i = 0; i < prices.size(); ++i) {
+      prices[i] = price{static_cast<double>(i) / 4};
+    }
+    prices.flush();
+  }
+
+  st::mapped_array<const price> prices{path};
+  ASSERT_EQ(prices.size(), 1000u);
+  ASSERT_EQ(prices[4], price{1.});
+  price total{0.};
+  for (const price& p : prices) {
+    total += p;
+  }
+  ASSERT_EQ(total, price{999. * 1000 / 8});
+
+#ifdef __cpp_lib_span
+  std::span<const price> view = prices;
+  ASSERT_EQ(view.back(), price{999. / 4});
+#endif
+
+  // Modifications through a writable mapping are visible to the others
+  {
+    st::mapped_array<price> writable{path};
+    writable[4] = price{-1.};
+  }
+  ASSERT_EQ(prices[4], price{-1.});
+
+  st::mapped_array<const price> moved{std::move(prices)};
+  ASSERT_EQ(moved.size(), 1000u);
+  ASSERT_EQ(prices.data(), nullptr);
+  std::remove(path.c_str());
+}
+
+TEST(MappedArray, Checks) {
+  ASSERT_THROW(st::mapped_array<const price>{temporary_file("missing")},
+               std::system_error);
+
+  const std::string path = temporary_file("ids");
+  st::mapped_array<order_id>::create(path, 10);
+  ASSERT_EQ(st::mapped_array<const order_id>{path}.size(), 10u);
+  // Same size and alignment, different type
+  ASSERT_THROW(st::mapped_array<const price>{path}, std::runtime_error);
+
+  // Truncated file
+  {
+    std::ofstream file{path, std::ios::binary | std::ios::app};
+    file.put('\0');
+  }
+  ASSERT_THROW(st::mapped_array<const order_id>{path}, std::runtime_error);
+
+  // Not a mapped array
+  {
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    file << std::string(128, 'x');
+  }
+  ASSERT_THROW(st::mapped_array<const order_id>{path}, std::runtime_error);
+  std::remove(path.c_str());
+
+  // Empty arrays are valid
+  st::mapped_array<order_id>::create(path, 0);
+  const st::mapped_array<const order_id> empty{path};
+  ASSERT_TRUE(empty.empty());
+  ASSERT_EQ(empty.begin(), empty.end());
+  std::remove(path.c_str());
+}
+
+#endif  // DPSG_STRONG_TYPES_MAPPED_ARRAY
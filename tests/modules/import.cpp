@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include <sstream>
+#include <unordered_set>
+
+import strong_types;
+
+namespace st = dpsg::strong_types;
+
+namespace {
+using meters = st::number<int, struct meters_tag, st::streamable>;
+
+enum class access { none = 0, read = 1, write = 2 };
+using permissions = st::flag<access, struct permissions_tag>;
+
+using id = st::strong_value<int, struct id_tag, st::hashable, st::comparable>;
+}  // namespace
+
+TEST(Module, Number) {
+  constexpr meters m1{2}, m2{40};
+  static_assert(m1 + m2 == meters{42}, "");
+  static_assert(m1 * 21 == 42, "");
+  static_assert(m1 < m2, "");
+
+  meters m3{m1};
+  m3 += m2;
+  ASSERT_EQ(m3, 42);
+  ASSERT_EQ(m3++, 42);
+  ASSERT_EQ(m3, 43);
+}
+
+TEST(Module, Flags) {
+  constexpr permissions p = permissions{access::read} | access::write;
+  static_assert((p & access::read) == access::read, "");
+  static_assert((p ^ access::write) == access::read, "");
+}
+
+TEST(Module, Hash) {
+  std::unordered_set<id> set;
+  set.insert(id{42});
+  ASSERT_EQ(set.count(id{42}), 1);
+}
+
+TEST(Module, Iostream) {
+  std::stringstream stream{"21"};
+  meters m;
+  stream >> m;
+  ASSERT_EQ(m, 21);
+
+  std::stringstream output;
+  output << m;
+  ASSERT_EQ(output.str(), "21");
+}
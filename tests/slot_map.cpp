@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <strong_types/slot_map.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+namespace st = dpsg::strong_types;
+
+namespace {
+using entity = st::handle<struct entity_tag>;
+using small_entity = st::handle<struct small_entity_tag, 20, 12>;
+}  // namespace
+
+TEST(SlotMap, Handles) {
+  static_assert(sizeof(entity) == sizeof(std::uint64_t),
+                "handles are stored in a single integer");
+  static_assert(sizeof(small_entity) == sizeof(std::uint32_t),
+                "handles use the smallest integer holding their bits");
+
+  constexpr small_entity h{5, 3};
+  static_assert(h.index() == 5 && h.generation() == 3,
+                "handles are usable in constant expressions");
+  ASSERT_EQ(h.value, (3u << 20) | 5u);
+  ASSERT_EQ(small_entity(1u << 20, 1).index(), 0u);
+
+  ASSERT_EQ(entity(1, 2), entity(1, 2));
+  ASSERT_NE(entity(1, 2), entity(1, 3));
+  ASSERT_LT(entity(1, 2), entity(2, 2));
+
+  std::unordered_set<entity> set{entity{1, 1}, entity{2, 1}, entity{1, 1}};
+  ASSERT_EQ(set.size(), 2u);
+}
+
+TEST(SlotMap, InsertEraseLookup) {
+  st::slot_map<entity, std::string> map;
+  const entity a = map.insert("a");
+  const entity b = map.emplace(1, 'b');
+  const entity c = map.insert("c");
+  ASSERT_EQ(map.size(), 3u);
+  ASSERT_EQ(map[a], "a");
+  ASSERT_EQ(map.at(b), "b");
+  ASSERT_FALSE(map.contains(entity{}));
+
+  ASSERT_TRUE(map.erase(a));
+  ASSERT_FALSE(map.erase(a));
+  ASSERT_FALSE(map.contains(a));
+  ASSERT_EQ(map.find(a), nullptr);
+  ASSERT_THROW(map.at(a), std::out_of_range);
+  ASSERT_EQ(map.size(), 2u);
+  // The other values are still reachable after being moved
+  ASSERT_EQ(map[b], "b");
+  ASSERT_EQ(*map.find(c), "c");
+
+  // The slot is reused with a new generation
+  const entity d = map.insert("d");
+  ASSERT_EQ(d.index(), a.index());
+  ASSERT_NE(d.generation(), a.generation());
+  ASSERT_FALSE(map.contains(a));
+  ASSERT_EQ(map[d], "d");
+}
+
+TEST(SlotMap, DenseIteration) {
+  st::slot_map<small_entity, int> map;
+  std::vector<small_entity> handles;
+  for (int i = 0; i < 10; ++i) {
+    handles.push_back(map.insert(i));
+  }
+  for (int i = 0; i < 10; i += 2) {
+    map.erase(handles[static_cast<std::size_t>(i)]);
+  }
+
+  int sum = 0;
+  for (int v : map) {
+    sum += v;
+  }
+  ASSERT_EQ(sum, 1 + 3 + 5 + 7 + 9);
+  ASSERT_EQ(map.end() - map.begin(), 5);
+
+  map.for_each([&](small_entity h, int& v) {
+    ASSERT_EQ(handles[static_cast<std::size_t>(v)], h);
+    v *= 2;
+  });
+  ASSERT_EQ(map[handles[3]], 6);
+
+  map.clear();
+  ASSERT_TRUE(map.empty());
+  ASSERT_FALSE(map.contains(handles[3]));
+  const small_entity reused = map.insert(42);
+  ASSERT_EQ(map[reused], 42);
+}
+
+TEST(SlotMap, Generations) {
+  using tiny = st::handle<struct tiny_tag, 2, 2>;
+  st::slot_map<tiny, std::unique_ptr<int>> map;
+  tiny h = map.emplace(new int{0});
+  for (int i = 1; i < 8; ++i) {
+    map.erase(h);
+    h = map.emplace(new int{i});
+    // The generation wraps around without ever being 0
+    ASSERT_NE(h.generation(), 0u);
+    ASSERT_EQ(*map[h], i);
+  }
+
+  for (int i = 0; i < 3; ++i) {
+    map.emplace(nullptr);
+  }
+  ASSERT_EQ(map.size(), 4u);
+  ASSERT_THROW(map.emplace(nullptr), std::length_error);
+}
+
+namespace {
+// Throws when built from a negative value
+struct checked {
+  int value;
+  explicit checked(int v) : value{v} {
+    if (v < 0) {
+      throw std::runtime_error("checked");
+    }
+  }
+};
+}  // namespace
+
+TEST(SlotMap, ThrowingConstructor) {
+  st::slot_map<entity, checked> map;
+  ASSERT_THROW(map.emplace(-1), std::runtime_error);
+  ASSERT_TRUE(map.empty());
+
+  // The slot wasn't lost: the first value still gets index 0
+  const entity first = map.emplace(1);
+  ASSERT_EQ(first.index(), 0u);
+  const entity second = map.emplace(2);
+  map.erase(first);
+
+  // The free slot is still free after a failure
+  ASSERT_THROW(map.emplace(-1), std::runtime_error);
+  ASSERT_EQ(map.size(), 1u);
+  const entity third = map.emplace(3);
+  ASSERT_EQ(third.index(), first.index());
+  ASSERT_FALSE(map.contains(first));
+
+  // Values and their owners are still in sync
+  ASSERT_EQ(map[second].value, 2);
+  ASSERT_EQ(map[third].value, 3);
+  for (std::size_t i = 0; i < map.size(); ++i) {
+    ASSERT_EQ(&map[map.handle_at(i)], map.data() + i);
+  }
+}
@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include <strong_types/soa_vector.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+namespace st = dpsg::strong_types;
+
+namespace {
+using order_id = st::strong_value<std::uint64_t, struct order_id_tag>;
+using price = st::number<double, struct price_tag>;
+using quantity = st::number<std::int32_t, struct quantity_tag>;
+
+using orders = st::soa_vector<order_id, price, quantity>;
+
+// Throws when copied from a value marked to throw
+struct fragile {
+  int value{0};
+  fragile() = default;
+  explicit fragile(int v) : value{v} {}
+  fragile(const fragile& other) : value{other.value} {
+    if (value < 0) {
+      throw std::runtime_error("fragile");
+    }
+  }
+  fragile& operator=(const fragile&) = default;
+};
+using note = st::strong_value<fragile, struct note_tag>;
+}  // namespace
+
+TEST(SoaVector, PushBack) {
+  orders book;
+  ASSERT_TRUE(book.empty());
+  book.push_back(order_id{1u}, price{10.5}, quantity{100});
+  book.push_back(std::make_tuple(order_id{2u}, price{11.}, quantity{-20}));
+  book.emplace_back(3u, 9.75, 7);
+  ASSERT_EQ(book.size(), 3u);
+  ASSERT_GE(book.capacity(), 3u);
+
+  ASSERT_EQ(book[0].get<order_id>().value, 1u);
+  ASSERT_EQ(book[1].get<price>(), price{11.});
+  ASSERT_EQ(book[2].get<2>(), quantity{7});
+  ASSERT_EQ(book.front().get<quantity>(), quantity{100});
+  ASSERT_EQ(book.back().get<order_id>().value, 3u);
+
+  book.pop_back();
+  ASSERT_EQ(book.size(), 2u);
+  ASSERT_THROW(book.at(2), std::out_of_range);
+}
+
+TEST(SoaVector, Columns) {
+  orders book;
+  for (std::uint64_t i = 0; i < 100; ++i) {
+    book.push_back(order_id{i}, price{static_cast<double>(i)},
+                   quantity{static_cast<std::int32_t>(i % 7)});
+  }
+  static_assert(std::is_same<decltype(book.data<price>()), price*>::value,
+                "columns are arrays of strong types");
+  const price* prices = book.data<price>();
+  for (std::size_t i = 0; i < book.size(); ++i) {
+    ASSERT_EQ(prices[i], price{static_cast<double>(i)});
+  }
+  ASSERT_EQ(book.data<0>(), book.data<order_id>());
+  ASSERT_EQ(std::get<2>(book.columns()).size(), 100u);
+
+#ifdef __cpp_lib_span
+  std::span<quantity> quantities = book.column<quantity>();
+  ASSERT_EQ(quantities.size(), 100u);
+  quantities[3] = quantity{42};
+  ASSERT_EQ(book[3].get<quantity>(), quantity{42});
+  const orders& view = book;
+  std::span<const price> const_prices = view.column<1>();
+  ASSERT_EQ(const_prices[99], price{99.});
+#endif
+}
+
+TEST(SoaVector, Rows) {
+  orders book;
+  book.push_back(order_id{1u}, price{10.}, quantity{1});
+  book.push_back(order_id{2u}, price{20.}, quantity{2});
+
+  // Rows refer to the columns
+  auto row = book[0];
+  row.get<price>() += price{1.};
+  ASSERT_EQ(book.data<price>()[0], price{11.});
+
+  row = std::make_tuple(order_id{5u}, price{50.}, quantity{5});
+  ASSERT_EQ(book[0].get<order_id>().value, 5u);
+
+  // Assigning a row assigns the fields
+  book[0] = book[1];
+  ASSERT_EQ(book[0].get<order_id>().value, 2u);
+  ASSERT_EQ(book[1].get<order_id>().value, 2u);
+
+  const orders::value_type copy = book[1];
+  ASSERT_EQ(std::get<quantity>(copy), quantity{2});
+
+  book[1].get<order_id>() = order_id{7u};
+  swap(book[0], book[1]);
+  ASSERT_EQ(book[0].get<order_id>().value, 7u);
+  ASSERT_EQ(book[1].get<order_id>().value, 2u);
+
+  const orders& view = book;
+  static_assert(
+      std::is_same<decltype(view[0].get<price>()), const price&>::value,
+      "rows of const vectors are read only");
+}
+
+#if __cplusplus >= 201703L
+TEST(SoaVector, StructuredBindings) {
+  orders book;
+  book.push_back(order_id{1u}, price{10.}, quantity{1});
+  book.push_back(order_id{2u}, price{20.}, quantity{2});
+  for (auto [id, p, q] : book) {
+    q += quantity{static_cast<std::int32_t>(id.value)};
+  }
+  ASSERT_EQ(book[0].get<quantity>(), quantity{2});
+  ASSERT_EQ(book[1].get<quantity>(), quantity{4});
+}
+#endif
+
+TEST(SoaVector, Iterators) {
+  orders book;
+  for (std::uint64_t i = 0; i < 10; ++i) {
+    book.push_back(order_id{i}, price{static_cast<double>(i) * 2},
+                   quantity{0});
+  }
+  ASSERT_EQ(book.end() - book.begin(), 10);
+  orders::const_iterator it = book.begin();
+  ASSERT_EQ((*(it + 4)).get<price>(), price{8.});
+  ASSERT_EQ(it[9].get<order_id>().value, 9u);
+  ASSERT_TRUE(it < book.cend());
+
+  const auto found = std::find_if(book.begin(), book.end(), [](auto row) {
+    return row.template get<price>() == price{12.};
+  });
+  ASSERT_EQ(found - book.begin(), 6);
+
+  std::size_t count = 0;
+  for (auto row : book) {
+    row.get<quantity>() = quantity{1};
+    ++count;
+  }
+  ASSERT_EQ(count, 10u);
+  ASSERT_EQ(book[5].get<quantity>(), quantity{1});
+}
+
+TEST(SoaVector, Resize) {
+  orders book{4};
+  ASSERT_EQ(book.size(), 4u);
+  ASSERT_EQ(book[3].get<price>(), price{0.});
+  book.reserve(32);
+  ASSERT_GE(book.capacity(), 32u);
+  book.resize(2);
+  ASSERT_EQ(book.size(), 2u);
+  ASSERT_EQ(std::get<1>(book.columns()).size(), 2u);
+  book.clear();
+  ASSERT_TRUE(book.empty());
+
+  orders other;
+  other.push_back(order_id{1u}, price{1.}, quantity{1});
+  swap(book, other);
+  ASSERT_EQ(book.size(), 1u);
+  ASSERT_TRUE(other.empty());
+}
+
+TEST(SoaVector, FromColumns) {
+  orders::columns_type columns;
+  std::get<0>(columns) = {order_id{1u}, order_id{2u}};
+  std::get<1>(columns) = {price{1.}, price{2.}};
+  std::get<2>(columns) = {quantity{1}, quantity{2}};
+  const orders book{columns};
+  ASSERT_EQ(book.size(), 2u);
+  ASSERT_EQ(book[1].get<price>(), price{2.});
+
+  std::get<2>(columns).pop_back();
+  ASSERT_THROW(orders{columns}, std::invalid_argument);
+}
+
+TEST(SoaVector, RowsAddedToEveryColumnOrNone) {
+  st::soa_vector<order_id, note, quantity> rows;
+  rows.push_back(order_id{1u}, note{fragile{1}}, quantity{1});
+  note broken;
+  broken.value.value = -1;
+  ASSERT_THROW(rows.emplace_back(order_id{2u}, broken, quantity{2}),
+               std::runtime_error);
+  ASSERT_EQ(rows.size(), 1u);
+  ASSERT_EQ(std::get<0>(rows.columns()).size(), 1u);
+  ASSERT_EQ(std::get<1>(rows.columns()).size(), 1u);
+  ASSERT_EQ(std::get<2>(rows.columns()).size(), 1u);
+}
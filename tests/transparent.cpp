@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <strong_types.hpp>
+#include <strong_types/hash.hpp>
+#include <strong_types/transparent.hpp>
+
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+
+#ifdef __cpp_lib_string_view
+#include <string_view>
+#endif
+
+namespace st = dpsg::strong_types;
+
+namespace {
+using user_id = st::strong_value<std::int64_t,
+                                 struct user_id_tag,
+                                 st::hashable,
+                                 st::comparable,
+                                 st::comparable_with<std::int64_t>>;
+using session_id = st::strong_value<std::uint64_t,
+                                    struct session_id_tag,
+                                    st::hashable_with<st::fibonacci_hash>,
+                                    st::comparable,
+                                    st::comparable_with<std::uint64_t>>;
+
+template <class T, class U, class = void>
+struct is_hashable_with : std::false_type {};
+template <class T, class U>
+struct is_hashable_with<
+    T,
+    U,
+    st::detail::void_t<decltype(st::transparent_hash<T>{}(std::declval<U>()))>>
+    : std::true_type {};
+}  // namespace
+
+TEST(Transparent, Hash) {
+  const st::transparent_hash<user_id> user_hash;
+  ASSERT_EQ(user_hash(user_id{42}), user_hash(std::int64_t{42}));
+  ASSERT_EQ(user_hash(user_id{42}), user_hash(42));
+
+  const st::transparent_hash<session_id> session_hash;
+  ASSERT_EQ(session_hash(session_id{7u}), session_hash(std::uint64_t{7}));
+  ASSERT_EQ(session_hash(session_id{7u}), st::fibonacci_hash{}(7u));
+
+  static_assert(is_hashable_with<user_id, int>::value, "");
+  static_assert(!is_hashable_with<user_id, std::string>::value, "");
+}
+
+TEST(Transparent, Ordered) {
+  std::set<user_id, st::transparent_less> users{user_id{1}, user_id{3}};
+  ASSERT_NE(users.find(std::int64_t{3}), users.end());
+  ASSERT_EQ(users.find(std::int64_t{2}), users.end());
+  ASSERT_EQ(users.count(std::int64_t{1}), 1);
+
+  std::map<session_id, int, st::transparent_less> sessions{{session_id{1u}, 1}};
+  ASSERT_EQ(sessions.find(std::uint64_t{1})->second, 1);
+
+  ASSERT_TRUE(st::transparent_equal_to{}(user_id{1}, std::int64_t{1}));
+  ASSERT_TRUE(st::transparent_equal_to{}(std::int64_t{1}, user_id{1}));
+  ASSERT_FALSE(st::transparent_less{}(user_id{1}, std::int64_t{1}));
+}
+
+#ifdef __cpp_lib_string_view
+namespace {
+using name = st::strong_value<std::string,
+                              struct name_tag,
+                              st::hashable,
+                              st::comparable,
+                              st::comparable_with<std::string_view>>;
+using wy_name = st::strong_value<std::string,
+                                 struct wy_name_tag,
+                                 st::hashable_with<st::wy_hash>,
+                                 st::comparable,
+                                 st::comparable_with<std::string_view>>;
+}  // namespace
+
+TEST(Transparent, Strings) {
+  const st::transparent_hash<name> name_hash;
+  ASSERT_EQ(name_hash(name{"alice"}), name_hash(std::string_view{"alice"}));
+  ASSERT_EQ(name_hash(name{"alice"}), name_hash("alice"));
+
+  const st::transparent_hash<wy_name> wy_name_hash;
+  ASSERT_EQ(wy_name_hash(wy_name{"bob"}), wy_name_hash(std::string_view{"bob"}));
+
+  std::set<name, st::transparent_less> names{name{"alice"}, name{"bob"}};
+  ASSERT_NE(names.find(std::string_view{"bob"}), names.end());
+}
+#endif
+
+#ifdef __cpp_lib_generic_unordered_lookup
+TEST(Transparent, Unordered) {
+  std::unordered_map<name, int, st::transparent_hash<name>,
+                     st::transparent_equal_to>
+      ages{{name{"alice"}, 32}};
+  ASSERT_EQ(ages.find(std::string_view{"alice"})->second, 32);
+  ASSERT_FALSE(ages.contains(std::string_view{"bob"}));
+
+  std::unordered_set<user_id, st::transparent_hash<user_id>,
+                     st::transparent_equal_to>
+      users{user_id{5}};
+  ASSERT_EQ(users.count(std::int64_t{5}), 1);
+}
+#endif
@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <strong_types/wide_flag.hpp>
+
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace st = dpsg::strong_types;
+
+namespace {
+enum class feature : std::uint16_t {
+  export_pdf = 0,
+  sso = 1,
+  audit_log = 63,
+  api_access = 64,
+  custom_domain = 130,
+  priority_support = 299,
+};
+using features = st::wide_flag<feature, 300>;
+}  // namespace
+
+TEST(WideFlag, Operators) {
+  static_assert(features::word_count == 5, "");
+
+  constexpr features basic =
+      features{feature::export_pdf} | feature::api_access;
+  constexpr features premium =
+      basic | feature::sso | feature::custom_domain | feature::priority_support;
+  static_assert(premium.test(feature::priority_support), "");
+  static_assert(!basic.test(feature::sso), "");
+  static_assert((premium & basic) == basic, "");
+  static_assert((premium ^ basic) ==
+                    (features{feature::sso} | feature::custom_domain |
+                     feature::priority_support),
+                "");
+  static_assert((basic & feature::api_access) == feature::api_access, "");
+  static_assert((feature::api_access | basic) == basic, "");
+
+  features f{feature::audit_log};
+  static_assert(std::is_same<features&, decltype(f |= feature::sso)>::value,
+                "");
+  f |= premium;
+  f &= ~features{feature::sso};
+  f ^= feature::export_pdf;
+  ASSERT_EQ(f, (features{feature::audit_log} | feature::api_access |
+                feature::custom_domain | feature::priority_support));
+  ASSERT_EQ(st::and_not(premium, basic),
+            (features{feature::sso} | feature::custom_domain |
+             feature::priority_support));
+  f.reset(premium);
+  ASSERT_EQ(f, feature::audit_log);
+  f.reset(feature::audit_log);
+  ASSERT_EQ(f, features{});
+}
+
+TEST(WideFlag, Queries) {
+  const features none{};
+  ASSERT_EQ(st::count(~none), 300u);
+  ASSERT_EQ(st::count(none), 0u);
+  ASSERT_TRUE(st::none(none));
+  ASSERT_FALSE(st::any(none));
+
+  const features granted = features{feature::sso} | feature::api_access |
+                           feature::priority_support;
+  const features required = features{feature::sso} | feature::priority_support;
+  ASSERT_EQ(st::count(granted), 3u);
+  ASSERT_TRUE(st::all_of(granted, required));
+  ASSERT_FALSE(st::all_of(required, granted));
+  ASSERT_TRUE(st::all_of(granted, feature::api_access));
+  ASSERT_TRUE(st::any_of(required, features{feature::sso}));
+  ASSERT_FALSE(st::any_of(granted, feature::custom_domain));
+  ASSERT_TRUE(st::all_of(granted, none));
+
+  std::vector<feature> visited;
+  st::for_each_set_bit(granted, [&](feature f) { visited.push_back(f); });
+  ASSERT_EQ(visited, (std::vector<feature>{feature::sso, feature::api_access,
+                                           feature::priority_support}));
+}
+
+TEST(WideFlag, EveryWord) {
+  // Every bit of every word goes through the SIMD and scalar paths
+  using wide = st::wide_flag<feature, 520>;
+  wide odd;
+  wide all;
+  for (std::uint16_t i = 0; i < 520; ++i) {
+    all.set(static_cast<feature>(i));
+    if (i % 2 == 1) {
+      odd.set(static_cast<feature>(i));
+    }
+  }
+  ASSERT_EQ(all, ~wide{});
+  ASSERT_EQ(st::count(odd), 260u);
+  ASSERT_EQ(st::count(~odd), 260u);
+  ASSERT_EQ(odd | ~odd, all);
+  ASSERT_EQ(st::count(odd & ~odd), 0u);
+  ASSERT_TRUE(st::all_of(all, odd));
+  wide missing_last{odd};
+  missing_last.reset(static_cast<feature>(519));
+  ASSERT_FALSE(st::all_of(missing_last, odd));
+  ASSERT_TRUE(st::all_of(odd, missing_last));
+}